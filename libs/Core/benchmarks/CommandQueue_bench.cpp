@@ -0,0 +1,118 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Measures how fast many producer threads can hand commands to a
+ * single consumer thread.
+ *
+ * The lock-free CommandQueue is compared to a std::queue guarded by
+ * a std::mutex, which is how the CommandExecuter used to store its
+ * commands.
+ */
+
+#include <Spix/CommandExecuter/CommandQueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int commandsPerProducer = 200000;
+
+class NoopCmd : public spix::cmd::Command {
+public:
+    void execute(spix::CommandEnvironment&) override {}
+};
+
+class MutexQueue {
+public:
+    void push(std::unique_ptr<spix::cmd::Command> command)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.emplace(std::move(command));
+    }
+
+    std::unique_ptr<spix::cmd::Command> pop()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_queue.empty()) {
+            return nullptr;
+        }
+        auto command = std::move(m_queue.front());
+        m_queue.pop();
+        return command;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::queue<std::unique_ptr<spix::cmd::Command>> m_queue;
+};
+
+template <typename Queue>
+void Run(const std::string& name, int producers)
+{
+    Queue queue;
+    std::atomic<bool> go {false};
+    std::vector<double> pushTimes(producers);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < commandsPerProducer; ++i) {
+                queue.push(std::make_unique<NoopCmd>());
+            }
+            std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+            pushTimes[p] = duration.count() / commandsPerProducer;
+        });
+    }
+
+    const int total = producers * commandsPerProducer;
+    int received = 0;
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    while (received < total) {
+        if (queue.pop()) {
+            ++received;
+        }
+    }
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    double maxPushTime = 0.0;
+    for (auto pushTime : pushTimes) {
+        maxPushTime = std::max(maxPushTime, pushTime);
+    }
+
+    std::cout << name << " | " << producers << " producers: " << total << " commands in " << duration.count() << "ms"
+              << " | " << total / duration.count() / 1000.0 << "M commands/s"
+              << " | slowest producer " << maxPushTime << "ns/push" << std::endl;
+}
+
+} // namespace
+
+int main()
+{
+    for (int producers : {1, 4, 16}) {
+        Run<MutexQueue>("mutex queue", producers);
+        Run<spix::CommandQueue>("lock-free queue", producers);
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Compares the latency and throughput of the AnyRpcServer transports.
+ *
+ * A client on the loopback interface sends small `existsAndVisible`
+ * calls to measure the round trip time, and then reads a large string
+ * property (similar to a base64 encoded screenshot) to measure the
+ * throughput of each transport.
+ *
+ * The commands are executed on a MockScene by the main thread, so the
+ * numbers only contain the cost of the transport and command queue.
+ */
+
+#include <Scene/Mock/MockScene.h>
+#include <Spix/AnyRpcServer.h>
+#include <Spix/CommandExecuter/CommandExecuter.h>
+
+#include <anyrpc/anyrpc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int latencyIterations = 500;
+constexpr int throughputIterations = 50;
+constexpr size_t largePropertySize = 1024 * 1024;
+constexpr int basePort = 9300;
+
+struct TransportInfo {
+    std::string name;
+    spix::AnyRpcServer::Transport transport;
+};
+
+std::unique_ptr<anyrpc::Client> MakeClient(spix::AnyRpcServer::Transport transport)
+{
+    switch (transport) {
+    case spix::AnyRpcServer::Transport::JsonTcp:
+        return std::make_unique<anyrpc::JsonTcpClient>();
+    case spix::AnyRpcServer::Transport::MessagePackTcp:
+        return std::make_unique<anyrpc::MessagePackTcpClient>();
+    case spix::AnyRpcServer::Transport::XmlHttp:
+        break;
+    }
+    return std::make_unique<anyrpc::XmlHttpClient>();
+}
+
+bool Call(anyrpc::Client& client, const char* method, const std::vector<std::string>& args, anyrpc::Value& result)
+{
+    anyrpc::Value params;
+    params.SetArray();
+    for (size_t i = 0; i < args.size(); ++i) {
+        params[i] = anyrpc::Value(args[i]);
+    }
+    return client.Call(method, params, result);
+}
+
+void RunClient(const TransportInfo& info, int port)
+{
+    auto client = MakeClient(info.transport);
+    client->SetServer("127.0.0.1", port);
+    client->SetTimeout(5000);
+
+    std::vector<double> latencies;
+    latencies.reserve(latencyIterations);
+
+    anyrpc::Value result;
+    for (int i = 0; i < latencyIterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (!Call(*client, "existsAndVisible", {"window/item"}, result)) {
+            std::cout << info.name << ": call failed" << std::endl;
+            return;
+        }
+        std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - start;
+        latencies.push_back(latency.count());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0.0;
+    for (auto latency : latencies) {
+        total += latency;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < throughputIterations; ++i) {
+        if (!Call(*client, "getStringProperty", {"window/item", "data"}, result)) {
+            std::cout << info.name << ": call failed" << std::endl;
+            return;
+        }
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    double megabytes = static_cast<double>(largePropertySize) * throughputIterations / (1024.0 * 1024.0);
+
+    std::cout << info.name << ": " << latencyIterations << " round trips"
+              << " | mean " << total / latencyIterations << "us"
+              << " | median " << latencies[latencyIterations / 2] << "us"
+              << " | p99 " << latencies[latencyIterations * 99 / 100] << "us"
+              << " | large reads " << megabytes / duration.count() << "MB/s" << std::endl;
+}
+
+void RunTransport(spix::MockScene& scene, const TransportInfo& info, int port)
+{
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool pending = false;
+    bool done = false;
+
+    spix::CommandExecuter exec;
+    exec.setWakeupHandler([&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = true;
+        wakeup.notify_one();
+    });
+
+    spix::AnyRpcServer server(port, info.transport);
+    server.setCommandExecuter(&exec);
+    server.start();
+
+    std::thread client([&] {
+        RunClient(info, port);
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        wakeup.notify_one();
+    });
+
+    // Act as the GUI thread of the application
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!done) {
+        wakeup.wait(lock, [&] { return pending || done; });
+        pending = false;
+        lock.unlock();
+        exec.processCommands(scene);
+        lock.lock();
+    }
+    lock.unlock();
+
+    client.join();
+}
+
+} // namespace
+
+int main()
+{
+    spix::MockScene scene;
+    spix::MockItem item {spix::Size(100.0, 30.0)};
+    item.stringProperties()["data"] = std::string(largePropertySize, 'A');
+    scene.addItemAtPath(item, "window/item");
+
+    const std::vector<TransportInfo> transports {
+        {"XML-RPC over HTTP", spix::AnyRpcServer::Transport::XmlHttp},
+        {"JSON-RPC over TCP", spix::AnyRpcServer::Transport::JsonTcp},
+        {"MessagePack over TCP", spix::AnyRpcServer::Transport::MessagePackTcp},
+    };
+
+    int port = basePort;
+    for (const auto& info : transports) {
+        RunTransport(scene, info, port++);
+    }
+
+    return 0;
+}
@@ -21,10 +21,33 @@ struct AnyRpcServerPimpl;
  * test commands. This allows testing and controlling the
  * application through external scripts (e.g. python with
  * its xml-rpc library).
+ *
+ * Instead of XML-RPC over HTTP, the same methods can be served
+ * as JSON-RPC or MessagePack-RPC over a persistent TCP connection
+ * with length-prefixed (netstring) messages. This avoids the XML
+ * encoding and HTTP framing overhead for many small calls.
+ *
+ * By default, all connections are served by a single thread, so a
+ * blocking call delays the calls of every other client. With
+ * `Threading::ThreadPerConnection`, each connection is served by its
+ * own thread. Requests of one connection are still handled in order,
+ * but several clients can be served at once.
  */
 class SPIXCORE_EXPORT AnyRpcServer : public TestServer {
 public:
-    AnyRpcServer(int anyrpcPort = 9000);
+    enum class Transport {
+        XmlHttp,
+        JsonTcp,
+        MessagePackTcp,
+    };
+
+    enum class Threading {
+        SingleThreaded,
+        ThreadPerConnection,
+    };
+
+    AnyRpcServer(int anyrpcPort = 9000, Transport transport = Transport::XmlHttp,
+        Threading threading = Threading::SingleThreaded);
     ~AnyRpcServer() override;
 
 protected:
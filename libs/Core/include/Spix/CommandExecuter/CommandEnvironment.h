@@ -10,25 +10,56 @@
 
 #include <Spix/CommandExecuter/ExecuterState.h>
 
+#include <chrono>
 #include <string>
 #include <vector>
 
 namespace spix {
 
+class ImageCache;
 class Scene;
+class SharedImageStore;
+class SubscriptionStore;
+class WorkerPool;
 
 using CommandError = std::string;
 
 class SPIXCORE_EXPORT CommandEnvironment {
 public:
-    CommandEnvironment(Scene& scene, ExecuterState& state);
+    CommandEnvironment(Scene& scene, ExecuterState& state, WorkerPool& workers, ImageCache& imageCache,
+        SharedImageStore& sharedImages, SubscriptionStore& subscriptions);
 
     Scene& scene();
     ExecuterState& state();
+    WorkerPool& workers();
+    ImageCache& imageCache();
+    SharedImageStore& sharedImages();
+    SubscriptionStore& subscriptions();
+
+    /**
+     * @brief Have the waiting command checked again at `deadline` at the latest
+     *
+     * For commands whose `canExecuteNow` returns false and that only wait
+     * for a deadline, or for changes that wake up the executer anyway.
+     * Waiting commands that do not call it are checked on every polling tick.
+     */
+    void wakeUpAt(std::chrono::steady_clock::time_point deadline);
+
+    /// Earliest deadline passed to `wakeUpAt`, or `time_point::max()`
+    std::chrono::steady_clock::time_point nextWakeUp() const;
+
+    /// Returns whether `wakeUpAt` was called since the last call to this method
+    bool takeWakeUpScheduled();
 
 private:
     Scene& m_scene;
     ExecuterState& m_state;
+    WorkerPool& m_workers;
+    ImageCache& m_imageCache;
+    SharedImageStore& m_sharedImages;
+    SubscriptionStore& m_subscriptions;
+    std::chrono::steady_clock::time_point m_nextWakeUp = std::chrono::steady_clock::time_point::max();
+    bool m_wakeUpScheduled = false;
 };
 
 } // namespace spix
@@ -8,12 +8,20 @@
 
 #include <Spix/spix_core_export.h>
 
+#include <Spix/CommandExecuter/CommandQueue.h>
 #include <Spix/CommandExecuter/ExecuterState.h>
+#include <Spix/CommandExecuter/ImageCache.h>
+#include <Spix/CommandExecuter/SharedImageStore.h>
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+#include <Spix/CommandExecuter/WorkerPool.h>
 #include <Spix/Commands/Command.h>
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <list>
 #include <memory>
-#include <mutex>
-#include <queue>
 #include <thread>
 
 namespace spix {
@@ -27,17 +35,87 @@ class Scene;
  * be processed on the main thread.
  *
  * Commands can be enqueued from any thread, but all other
- * methods have to be called from the main thread.
+ * methods have to be called from the main thread. Enqueueing
+ * never blocks.
+ *
+ * Work that does not need the main thread, like encoding screenshots,
+ * is handed to a small `WorkerPool`. Errors of those jobs are reported
+ * with the next call to `processCommands`.
+ *
+ * Commands are executed in the order they were enqueued, but only within
+ * a lane: the commands of each enqueueing thread form a lane of their
+ * own. A command that waits for a condition (e.g. `WaitForItem`) holds
+ * back the commands behind it in its lane, while other lanes go on. A
+ * server that serves each connection on its own thread thus keeps one
+ * client's wait from blocking the others.
+ *
+ * `enqueueCommandGroup` enqueues several commands of a thread at once.
+ * They are executed back to back, without commands of other lanes in
+ * between.
+ *
+ * Instead of polling `processCommands` at a fixed rate, the owner
+ * of the executer can register a wakeup handler that is called
+ * whenever new commands arrive, and only keep a timer running while
+ * `hasPendingCommands` returns true. `nextCheckDelay` tells when the
+ * timer has to fire: waiting commands that only wait for a deadline
+ * (e.g. `Wait`) are checked right when it passed, all others are
+ * polled.
  */
 class SPIXCORE_EXPORT CommandExecuter {
 public:
+    using WakeupHandler = std::function<void()>;
+
     CommandExecuter();
 
     ExecuterState& state();
 
+    /**
+     * @brief Set a handler that is called when new commands were enqueued
+     *
+     * The handler is called on the thread that enqueued the command. It
+     * should schedule a call to `processCommands` on the main thread
+     * and return immediately. Calls are coalesced, so the handler is
+     * invoked at most once until the next call to `processCommands`.
+     *
+     * Has to be set before any commands are enqueued.
+     */
+    void setWakeupHandler(WakeupHandler handler);
+
     void enqueueCommand(std::unique_ptr<cmd::Command> command);
     void processCommands(Scene& scene);
 
+    /**
+     * @brief Enqueue the commands issued by `enqueueCommands` as one group
+     *
+     * Calls `enqueueCommands` on the calling thread and collects the commands
+     * it enqueues from this thread. Once it returns, they are enqueued at once
+     * and executed back to back. Commands of other lanes only run while a
+     * command of the group waits for a condition.
+     *
+     * The commands are not enqueued before `enqueueCommands` returns, so it
+     * must not wait for their results.
+     */
+    void enqueueCommandGroup(const std::function<void()>& enqueueCommands);
+
+    /**
+     * @brief Returns true if commands are left in the queue
+     *
+     * After `processCommands`, this is the case when a command is
+     * waiting for a condition (e.g. a timeout in `Wait`) and the
+     * queue has to be processed again later.
+     */
+    bool hasPendingCommands();
+
+    /**
+     * @brief Time until `processCommands` has to be called again
+     *
+     * This is `pollingInterval` if a waiting command has to check a
+     * condition on every tick, otherwise the time until the earliest
+     * deadline of the waiting commands, rounded up to milliseconds.
+     * Only meaningful while `hasPendingCommands` returns true.
+     */
+    std::chrono::milliseconds nextCheckDelay(std::chrono::milliseconds pollingInterval);
+
     template <typename CmdType, typename... Args>
     void enqueueCommand(Args&&... args)
     {
@@ -45,12 +123,42 @@ public:
     }
 
 private:
+    struct PendingCommand {
+        unsigned long long sequence;
+        std::unique_ptr<cmd::Command> command;
+    };
+    struct Lane {
+        CommandQueue::Lane id;
+        std::deque<PendingCommand> commands;
+        bool waiting = false;
+    };
+
+    void takeQueuedCommands();
+    bool executeLanes(CommandEnvironment& env);
+
     std::thread::id m_mainThreadId;
-    std::mutex m_mutex;
 
-    std::queue<std::unique_ptr<cmd::Command>> m_commandQueue;
+    CommandQueue m_commandQueue;
+
+    // Commands taken from the queue, by lane. Main thread access only.
+    std::list<Lane> m_lanes;
+    unsigned long long m_nextSequence = 0;
+
+    // Set by processCommands for the waiting commands
+    bool m_needsPolling = false;
+    std::chrono::steady_clock::time_point m_nextDeadline;
+
+    WakeupHandler m_wakeupHandler;
+    std::atomic<bool> m_wakeupPending {false};
 
     ExecuterState m_state;
+    ImageCache m_imageCache;
+    SharedImageStore m_sharedImages;
+    SubscriptionStore m_subscriptions;
+
+    // Declared last, so that running jobs can still wake up the
+    // executer while the pool shuts down
+    WorkerPool m_workers;
 };
 
 } // namespace spix
@@ -0,0 +1,68 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Commands/Command.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace spix {
+
+/**
+ * @brief Lock-free multi-producer/single-consumer queue of commands
+ *
+ * Any thread can `push` commands without blocking. Only a single
+ * thread (the main thread of the `CommandExecuter`) may call `front`,
+ * `pop` and `empty`.
+ *
+ * A command that is still being pushed by another thread may not be
+ * visible to the consumer yet. It becomes visible as soon as `push`
+ * returns.
+ *
+ * Each command carries the lane it was enqueued on, usually the id of
+ * the producer thread.
+ */
+class SPIXCORE_EXPORT CommandQueue {
+public:
+    using Lane = std::thread::id;
+
+    CommandQueue();
+    ~CommandQueue();
+
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue& operator=(const CommandQueue&) = delete;
+
+    void push(std::unique_ptr<cmd::Command> command, Lane lane = {});
+
+    /**
+     * @brief Returns the oldest command or nullptr if the queue is empty
+     *
+     * The command stays in the queue.
+     */
+    cmd::Command* front() const;
+    Lane frontLane() const;
+    std::unique_ptr<cmd::Command> pop();
+    bool empty() const;
+
+private:
+    struct Node {
+        std::atomic<Node*> next {nullptr};
+        std::unique_ptr<cmd::Command> command;
+        Lane lane;
+    };
+
+    // Most recently pushed node, shared by all producers
+    std::atomic<Node*> m_back;
+    // Node in front of the oldest command. Its own command was already popped.
+    Node* m_front;
+};
+
+} // namespace spix
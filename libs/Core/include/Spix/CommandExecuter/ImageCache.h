@@ -0,0 +1,64 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/ImageComparison.h>
+
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace spix {
+
+/**
+ * @brief Keeps decoded golden images in memory across comparisons
+ *
+ * Images are looked up by file path. An entry is dropped when the
+ * file was modified after it was loaded. If the cache grows beyond
+ * its size limit, the least recently used images are removed.
+ *
+ * All methods can be called from any thread.
+ */
+class SPIXCORE_EXPORT ImageCache {
+public:
+    explicit ImageCache(size_t maxBytes);
+
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    /**
+     * @brief The cached image of the file, or nullptr if it has to be loaded
+     */
+    std::shared_ptr<const RgbaImage> find(const std::string& filePath);
+    void insert(const std::string& filePath, std::shared_ptr<const RgbaImage> image);
+    void clear();
+
+    size_t size();
+
+private:
+    struct Entry {
+        std::string filePath;
+        std::filesystem::file_time_type modificationTime;
+        std::shared_ptr<const RgbaImage> image;
+    };
+    using Entries = std::list<Entry>;
+
+    void erase(Entries::iterator entry);
+
+    const size_t m_maxBytes;
+    std::mutex m_mutex;
+    size_t m_bytes = 0;
+    Entries m_entries; // most recently used first
+    std::unordered_map<std::string, Entries::iterator> m_entriesByPath;
+};
+
+} // namespace spix
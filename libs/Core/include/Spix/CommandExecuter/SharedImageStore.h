@@ -0,0 +1,65 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/SharedImage.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace spix {
+
+class Image;
+
+namespace utils {
+class SharedMemory;
+}
+
+/**
+ * @brief Owns the shared memory segments of screenshots sent to local clients
+ *
+ * A segment stays available until the client releases it. To bound the
+ * memory of clients that never do, the oldest segments are removed once
+ * there are more than `maxImages`. Removing a segment does not affect
+ * clients that already mapped it.
+ *
+ * All methods can be called from any thread.
+ */
+class SPIXCORE_EXPORT SharedImageStore {
+public:
+    explicit SharedImageStore(size_t maxImages);
+    ~SharedImageStore();
+
+    SharedImageStore(const SharedImageStore&) = delete;
+    SharedImageStore& operator=(const SharedImageStore&) = delete;
+
+    /**
+     * @brief Write the pixels of an image as RGBA into a new segment
+     *
+     * The image converts its pixels straight into the mapped segment.
+     * Returns a descriptor with an empty name if no segment could be created.
+     */
+    SharedImage publish(const Image& image);
+
+    /**
+     * @brief Remove the segment with the given name. Returns false if there is none.
+     */
+    bool release(const std::string& name);
+
+    size_t size();
+
+private:
+    const size_t m_maxImages;
+    std::mutex m_mutex;
+    std::deque<std::unique_ptr<utils::SharedMemory>> m_segments; // oldest first
+};
+
+} // namespace spix
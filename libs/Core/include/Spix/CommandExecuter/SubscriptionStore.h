@@ -0,0 +1,75 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/Variant.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace spix {
+
+/**
+ * @brief Property subscriptions of clients
+ *
+ * A subscription remembers the property values of an item that were
+ * last sent to the client, so that only changes are sent. All changes
+ * between two deliveries are coalesced into the latest value, and
+ * deliveries are at least `minInterval` apart.
+ *
+ * To bound the memory of clients that never unsubscribe, the oldest
+ * subscriptions are removed once there are more than `maxSubscriptions`.
+ *
+ * Main thread access only.
+ */
+class SPIXCORE_EXPORT SubscriptionStore {
+public:
+    struct Subscription {
+        ItemPath path;
+        std::vector<std::string> properties;
+        std::chrono::milliseconds minInterval;
+
+        // Scene::propertyChanges of each property when it was last read
+        std::map<std::string, long long> propertyChanges;
+        Variant::MapType sentValues;
+        bool sent = false;
+        std::chrono::steady_clock::time_point lastSent;
+    };
+
+    explicit SubscriptionStore(size_t maxSubscriptions);
+
+    /**
+     * @brief Add a subscription and return its id
+     *
+     * Ids are positive and not reused.
+     */
+    int add(ItemPath path, std::vector<std::string> properties, std::chrono::milliseconds minInterval);
+
+    /**
+     * @brief The subscription with the given id or nullptr if there is none
+     */
+    Subscription* find(int id);
+
+    /**
+     * @brief Remove the subscription with the given id. Returns false if there is none.
+     */
+    bool remove(int id);
+
+    size_t size() const;
+
+private:
+    const size_t m_maxSubscriptions;
+    int m_nextId = 1;
+    std::map<int, Subscription> m_subscriptions; // ids increase, so the oldest is first
+};
+
+} // namespace spix
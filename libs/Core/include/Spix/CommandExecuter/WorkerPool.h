@@ -0,0 +1,96 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace spix {
+
+/**
+ * @brief Bounded pool of threads for work that should not block the main thread
+ *
+ * Commands use it to encode screenshots and write files after capturing
+ * them on the main thread. The number of jobs that are queued or running
+ * is limited, because each of them may hold a full window image. Commands
+ * check `hasCapacity` in `canExecuteNow`, so that a burst of requests waits
+ * in the command queue instead of piling up images in memory. A command
+ * whose job can only be posted later, e.g. after an asynchronous capture,
+ * reserves its place with `reserve`.
+ *
+ * The threads are started with the first job. The destructor waits until
+ * all posted jobs are done.
+ */
+class SPIXCORE_EXPORT WorkerPool {
+public:
+    using Job = std::function<void()>;
+    using JobFinishedHandler = std::function<void()>;
+
+    WorkerPool(unsigned threadCount, unsigned maxJobs);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Set a handler that is called on the worker thread after each job
+     *
+     * Has to be set before the first job is posted.
+     */
+    void setJobFinishedHandler(JobFinishedHandler handler);
+
+    bool hasCapacity();
+
+    /**
+     * @brief Run `job` on a worker thread
+     *
+     * Jobs are accepted even if the pool is at its limit. Callers are
+     * expected to check `hasCapacity` first.
+     */
+    void post(Job job);
+
+    /**
+     * @brief Count a job that will be posted later against the limit
+     *
+     * Each reservation has to be ended by either `postReserved` or
+     * `cancelReservation`.
+     */
+    void reserve();
+    void postReserved(Job job);
+    void cancelReservation();
+
+    /**
+     * @brief Report an error from a job. Can be called from any thread.
+     */
+    void reportError(std::string error);
+    std::vector<std::string> takeErrors();
+
+private:
+    void run();
+
+    const unsigned m_threadCount;
+    const unsigned m_maxJobs;
+    JobFinishedHandler m_jobFinishedHandler;
+
+    std::mutex m_mutex;
+    std::condition_variable m_jobAvailable;
+    std::deque<Job> m_jobs;
+    unsigned m_runningJobs = 0;
+    unsigned m_reservedJobs = 0;
+    bool m_stopping = false;
+    std::vector<std::string> m_errors;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace spix
@@ -0,0 +1,39 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief How the pixels of an item are captured
+ *
+ * `Window` reads back the full window and crops the item from it, so it
+ * shows the item as it is visible on screen, including anything covering
+ * it. `Item` renders only the item itself, which is cheaper for small
+ * items and also works for items that are clipped or covered. `Default`
+ * lets the backend choose.
+ */
+enum class CaptureMode
+{
+    Default,
+    Window,
+    Item
+};
+
+/**
+ * @brief Parse "default", "window" or "item"
+ *
+ * Throws std::invalid_argument for unknown names.
+ */
+SPIXCORE_EXPORT CaptureMode captureModeFromString(const std::string& name);
+SPIXCORE_EXPORT std::string captureModeName(CaptureMode mode);
+
+} // namespace spix
@@ -0,0 +1,30 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/Geometry.h>
+
+namespace spix {
+
+/**
+ * @brief Which part of an item a screenshot shows and how large it may be
+ *
+ * Checks that only need a thumbnail or a part of an item can save most
+ * of the encoding time and payload this way.
+ */
+struct SPIXCORE_EXPORT CaptureOptions {
+    /// Part of the item in item coordinates, the whole item if empty
+    Rect region;
+
+    /// Largest size of the image in pixels, 0 for no limit. The aspect ratio is kept.
+    int maxWidth = 0;
+    int maxHeight = 0;
+};
+
+} // namespace spix
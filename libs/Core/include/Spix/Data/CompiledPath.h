@@ -0,0 +1,83 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/ItemPathComponent.h>
+
+#include <vector>
+
+namespace spix {
+namespace path {
+
+enum class SelectorKind
+{
+    Name,
+    Property,
+    Type,
+    Value,
+    PropertyValue
+};
+
+/**
+ * @brief A path selector with its values converted to the string types of a scene
+ *
+ * Scenes match a selector against every object visited in a search, so its
+ * values are converted once per lookup instead. `String` holds the name,
+ * type, text or property value, `Name` the property name.
+ */
+template <typename String, typename Name>
+struct BasicCompiledSelector {
+    using Kind = SelectorKind;
+
+    Kind kind;
+    String value;
+    Name property;
+};
+
+template <typename String, typename Name>
+using BasicCompiledPath = std::vector<BasicCompiledSelector<String, Name>>;
+
+/**
+ * @brief Convert the values of a selector with `toString` and `toName`
+ *
+ * Both take a `const std::string&`.
+ */
+template <typename String, typename Name, typename ToString, typename ToName>
+BasicCompiledSelector<String, Name> CompileSelector(const Selector& selector, ToString toString, ToName toName)
+{
+    if (auto name = std::get_if<NameSelector>(&selector)) {
+        return {SelectorKind::Name, toString(name->name()), {}};
+    }
+    if (auto property = std::get_if<PropertySelector>(&selector)) {
+        return {SelectorKind::Property, {}, toName(property->name())};
+    }
+    if (auto type = std::get_if<TypeSelector>(&selector)) {
+        return {SelectorKind::Type, toString(type->type()), {}};
+    }
+    if (auto value = std::get_if<ValueSelector>(&selector)) {
+        return {SelectorKind::Value, toString(value->value()), {}};
+    }
+    const auto& propertyValue = std::get<PropertyValueSelector>(selector);
+    return {SelectorKind::PropertyValue, toString(propertyValue.propertyValue()),
+        toName(propertyValue.propertyName())};
+}
+
+template <typename String, typename Name, typename ToString, typename ToName>
+BasicCompiledPath<String, Name> CompilePath(const ItemPath& path, ToString toString, ToName toName)
+{
+    BasicCompiledPath<String, Name> compiledPath;
+    compiledPath.reserve(path.length());
+    for (const auto& component : path.components()) {
+        compiledPath.push_back(CompileSelector<String, Name>(component.selector(), toString, toName));
+    }
+
+    return compiledPath;
+}
+
+} // namespace path
+} // namespace spix
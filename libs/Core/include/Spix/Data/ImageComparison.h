@@ -0,0 +1,45 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/Geometry.h>
+
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief Decoded image, RGBA with 8 bits per channel, rows without padding
+ */
+struct SPIXCORE_EXPORT RgbaImage {
+    int width = 0;
+    int height = 0;
+    std::string pixels;
+};
+
+/**
+ * @brief Result of comparing a screenshot with a golden image
+ *
+ * A pixel is a mismatch if any of its channels differs by more than
+ * the tolerance. If the sizes of the images differ, all pixels count
+ * as mismatches.
+ */
+struct SPIXCORE_EXPORT ImageComparison {
+    bool sizeMatches = false;
+    long long mismatchedPixels = 0;
+    double mismatchPercent = 0.0;
+
+    /// Bounding box of all mismatched pixels, empty if the images match
+    Rect changedRegion;
+
+    /// QOI encoded image that marks the mismatches in red, if requested
+    std::string diffImage;
+};
+
+} // namespace spix
@@ -0,0 +1,70 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <chrono>
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief Describes how a screenshot is encoded
+ *
+ * The encoding can be given as a string, e.g. `"png:1"`, `"jpeg:85"` or `"raw"`:
+ * - `raw`: uncompressed RGBA pixels, 8 bits per channel, rows without padding
+ * - `qoi`: fast lossless "Quite OK Image" format
+ * - `png[:level]`: PNG with a compression level from 0 (fastest) to 9 (smallest)
+ * - `jpeg[:quality]`: JPEG with a quality from 0 to 100
+ * - `webp[:quality]`: WebP with a quality from 0 to 100 (requires Qt's WebP plugin)
+ *
+ * Without a level, the default of the encoder is used.
+ */
+class SPIXCORE_EXPORT ImageEncoding {
+public:
+    enum class Format {
+        Raw,
+        Qoi,
+        Png,
+        Jpeg,
+        WebP,
+    };
+
+    static constexpr int DefaultLevel = -1;
+
+    ImageEncoding(Format format = Format::Png, int level = DefaultLevel);
+
+    /**
+     * @brief Parses an encoding string like `"png:1"`
+     *
+     * Throws std::invalid_argument if the string is not a valid encoding.
+     */
+    static ImageEncoding fromString(const std::string& encoding);
+
+    Format format() const;
+    int level() const;
+    std::string formatName() const;
+    std::string toString() const;
+
+private:
+    Format m_format;
+    int m_level;
+};
+
+/**
+ * @brief An encoded screenshot
+ */
+struct SPIXCORE_EXPORT EncodedImage {
+    ImageEncoding encoding;
+    int width = 0;
+    int height = 0;
+    std::string data;
+    std::chrono::microseconds encodeTime {0};
+};
+
+} // namespace spix
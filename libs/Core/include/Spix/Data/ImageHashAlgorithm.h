@@ -0,0 +1,37 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief How the content of a screenshot is hashed
+ *
+ * `XxHash` changes with any pixel. `DHash` and `PHash` are perceptual
+ * hashes: similar images have hashes that differ in only a few bits,
+ * so they can be compared with a tolerance (Hamming distance).
+ */
+enum class ImageHashAlgorithm
+{
+    XxHash,
+    DHash,
+    PHash
+};
+
+/**
+ * @brief Parse "xxhash", "dhash" or "phash"
+ *
+ * Throws std::invalid_argument for unknown names.
+ */
+SPIXCORE_EXPORT ImageHashAlgorithm imageHashAlgorithmFromString(const std::string& name);
+SPIXCORE_EXPORT std::string imageHashAlgorithmName(ImageHashAlgorithm algorithm);
+
+} // namespace spix
@@ -0,0 +1,37 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <cstddef>
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief Describes a screenshot that was written to shared memory
+ *
+ * A client on the same machine opens the segment by its name (POSIX
+ * `shm_open` with a leading '/', or a Windows file mapping) and reads
+ * the pixels from it directly. The name is empty if the screenshot
+ * could not be taken.
+ */
+struct SPIXCORE_EXPORT SharedImage {
+    std::string name;
+    int width = 0;
+    int height = 0;
+    int stride = 0;
+
+    /// Layout of the pixels, always "rgba8888" for now
+    std::string format;
+
+    /// Size of the segment in bytes, at least `stride * height`
+    size_t size = 0;
+};
+
+} // namespace spix
@@ -0,0 +1,111 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Scene/Image.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace spix {
+
+/**
+ * @brief Summary of a finished recording
+ *
+ * `captureTime` is the time the main thread spent grabbing frames,
+ * `encodeTime` the time the background thread spent encoding them.
+ */
+struct SPIXCORE_EXPORT RecordingStatistics {
+    long long frames = 0;
+    long long droppedFrames = 0;
+    long long bytesWritten = 0;
+    std::chrono::milliseconds duration {0};
+    std::chrono::microseconds averageCaptureTime {0};
+    std::chrono::microseconds maxCaptureTime {0};
+    std::chrono::microseconds averageEncodeTime {0};
+};
+
+/**
+ * @brief Writes the frames of a window to a file, e.g. to debug a flaky test
+ *
+ * The scene grabs frames on the main thread and hands them to `addFrame`,
+ * which only puts them into a ring buffer. A background thread encodes
+ * them and writes them to the file. If the ring buffer is full, new frames
+ * are dropped instead of blocking the main thread.
+ *
+ * The file is a stream of frames, so that a recording that was not
+ * finished (e.g. because the application crashed) can still be read
+ * up to the last complete frame. Every frame is run-length encoded,
+ * mostly as delta to the previous frame (see docs/recording.md).
+ */
+class SPIXCORE_EXPORT FrameRecorder {
+public:
+    FrameRecorder(const std::string& filePath, int fps, size_t bufferedFrames = 8);
+    ~FrameRecorder();
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    bool isOpen() const;
+    int fps() const;
+    std::chrono::microseconds frameInterval() const;
+
+    /**
+     * @brief Queue a frame for encoding, called from the main thread
+     *
+     * `captureTime` is the time it took to grab the frame.
+     */
+    void addFrame(std::unique_ptr<Image> frame, std::chrono::microseconds captureTime);
+
+    /**
+     * @brief Encode the remaining frames and close the file
+     *
+     * Blocks until all buffered frames are written.
+     */
+    RecordingStatistics finish();
+
+private:
+    struct Frame {
+        std::unique_ptr<Image> image;
+        std::chrono::microseconds timestamp {0};
+    };
+
+    void run();
+    void writeFrame(const Frame& frame);
+
+    const int m_fps;
+    const std::chrono::steady_clock::time_point m_startTime;
+    std::ofstream m_file;
+
+    std::mutex m_mutex;
+    std::condition_variable m_frameAvailable;
+    std::vector<Frame> m_ring;
+    size_t m_ringStart = 0;
+    size_t m_ringSize = 0;
+    bool m_finishing = false;
+    RecordingStatistics m_statistics;
+    std::chrono::microseconds m_totalCaptureTime {0};
+    std::chrono::microseconds m_totalEncodeTime {0};
+
+    // only used by the encoder thread
+    std::string m_previousPixels;
+    int m_previousWidth = 0;
+    int m_previousHeight = 0;
+    long long m_framesSinceKeyFrame = 0;
+
+    std::thread m_thread;
+};
+
+} // namespace spix
@@ -0,0 +1,125 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Data/CaptureOptions.h>
+#include <Spix/Data/ImageEncoding.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace spix {
+
+/**
+ * @brief A captured image, e.g. the screenshot of an item
+ *
+ * It is implemented by the different backends, which store the
+ * pixels in their native image type. Images are captured on the
+ * main thread, but the methods of an image can be called from
+ * any thread.
+ */
+class Image {
+public:
+    virtual ~Image() = default;
+
+    virtual int width() const = 0;
+    virtual int height() const = 0;
+
+    /**
+     * @brief The pixels as RGBA, 8 bits per channel, rows without padding
+     */
+    virtual std::string rgbaPixels() const = 0;
+
+    /**
+     * @brief Write the pixels of a rectangle as RGBA, 8 bits per channel, into `pixels`
+     *
+     * `pixels` holds `height` rows of `stride` bytes, e.g. a shared memory
+     * segment. The pixels are converted straight into it, without making a
+     * copy of the image first.
+     */
+    virtual void writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const = 0;
+
+    /**
+     * @brief Encode the image into a compressed file format (PNG, JPEG, ...)
+     *
+     * Returns false if the backend does not support the format.
+     */
+    virtual bool encode(const ImageEncoding& encoding, std::string& data) const = 0;
+
+    /**
+     * @brief Save the image to a file, in the format given by the file's suffix
+     */
+    virtual bool save(const std::string& filePath) const = 0;
+
+    /**
+     * @brief A copy of the given rectangle of the image, in pixels
+     */
+    virtual std::unique_ptr<Image> copy(int x, int y, int width, int height) const = 0;
+
+    /**
+     * @brief A copy scaled to the given size, with a filter that favors speed
+     */
+    virtual std::unique_ptr<Image> scaled(int width, int height) const = 0;
+};
+
+/**
+ * @brief A rectangle of another image, copied only when its pixels are read
+ *
+ * Allows the main thread to hand out the part of a window image that shows
+ * an item without copying it. The copy is made by the first thread that
+ * reads the pixels, usually a worker.
+ */
+class SPIXCORE_EXPORT CroppedImage : public Image {
+public:
+    CroppedImage(std::shared_ptr<const Image> source, int x, int y, int width, int height);
+
+    int width() const override;
+    int height() const override;
+    std::string rgbaPixels() const override;
+    void writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const override;
+    bool encode(const ImageEncoding& encoding, std::string& data) const override;
+    bool save(const std::string& filePath) const override;
+    std::unique_ptr<Image> copy(int x, int y, int width, int height) const override;
+    std::unique_ptr<Image> scaled(int width, int height) const override;
+
+private:
+    const Image& cropped() const;
+
+    std::shared_ptr<const Image> m_source;
+    int m_x;
+    int m_y;
+    int m_width;
+    int m_height;
+
+    mutable std::once_flag m_cropOnce;
+    mutable std::unique_ptr<Image> m_cropped;
+};
+
+/**
+ * @brief Encode an image and measure the time it takes
+ *
+ * `raw` and `qoi` are encoded by Spix itself, all other formats
+ * by the image. Returns false if the format is not supported.
+ */
+SPIXCORE_EXPORT bool encodeImage(const Image& image, const ImageEncoding& encoding, EncodedImage& result);
+
+/**
+ * @brief Crop and downscale the image of an item as given by `options`
+ *
+ * `itemSize` is the size of the item in item coordinates, which relates
+ * the region to the pixels of the image. Images are never enlarged.
+ * Returns `image` itself if nothing has to change, or nullptr if the
+ * region is outside of the item.
+ */
+SPIXCORE_EXPORT std::shared_ptr<Image> applyCaptureOptions(
+    std::shared_ptr<Image> image, const CaptureOptions& options, const Size& itemSize);
+
+} // namespace spix
@@ -29,6 +29,14 @@ public:
     virtual Point position() const = 0;
     virtual Rect bounds() const = 0;
     virtual std::string stringProperty(const std::string& name) const = 0;
+    /**
+     * @brief Returns the property with its type, or null if it does not exist
+     *
+     * Values of types that have no Variant equivalent are returned as null
+     * as well, so this never throws. Backends that only know string
+     * properties can rely on the default implementation.
+     */
+    virtual Variant property(const std::string& name) const { return Variant(stringProperty(name)); }
     virtual void setStringProperty(const std::string& name, const std::string& value) = 0;
     virtual bool invokeMethod(const std::string& method, const std::vector<Variant>& args, Variant& ret) = 0;
     virtual bool visible() const = 0;
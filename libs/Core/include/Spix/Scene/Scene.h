@@ -6,13 +6,19 @@
 
 #pragma once
 
+#include <Spix/Data/CaptureMode.h>
 #include <Spix/Data/Geometry.h>
 #include <Spix/Data/ItemPath.h>
+#include <Spix/Data/Variant.h>
 #include <Spix/Scene/Events.h>
+#include <Spix/Scene/FrameRecorder.h>
+#include <Spix/Scene/Image.h>
 #include <Spix/Scene/Item.h>
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace spix {
 
@@ -27,6 +33,8 @@ class PasteboardContent;
  */
 class Scene {
 public:
+    using ImageHandler = std::function<void(std::unique_ptr<Image>)>;
+
     virtual ~Scene() = default;
 
     // Request objects
@@ -38,6 +46,125 @@ public:
     // Tasks
     virtual void takeScreenshot(const ItemPath& targetItem, const std::string& filePath) = 0;
     virtual std::string takeScreenshotAsBase64(const ItemPath& targetItem) = 0;
+
+    /**
+     * @brief Capture the item at the given path without encoding it
+     *
+     * Returns nullptr if the item was not found or the backend
+     * does not support capturing images.
+     */
+    virtual std::unique_ptr<Image> grabImage(const ItemPath&) { return {}; }
+
+    /**
+     * @brief Capture the item at the given path in the given mode
+     *
+     * The image, or nullptr if the item was not found, is passed to
+     * `handler` on the main thread. Rendering an item on its own can take
+     * until the next frame, so the handler may be called after this
+     * returns, but it is always called exactly once. The default
+     * implementation ignores the mode and calls `grabImage` right away.
+     */
+    virtual void grabImageAsync(const ItemPath& targetItem, CaptureMode, ImageHandler handler)
+    {
+        handler(grabImage(targetItem));
+    }
+
+    /**
+     * @brief Capture several items at once
+     *
+     * Returns one image per path, in the same order. Backends can override
+     * this to grab each window only once and crop all of its items from it.
+     */
+    virtual std::vector<std::unique_ptr<Image>> grabImages(const std::vector<ItemPath>& targetItems)
+    {
+        std::vector<std::unique_ptr<Image>> images;
+        images.reserve(targetItems.size());
+        for (const auto& targetItem : targetItems) {
+            images.push_back(grabImage(targetItem));
+        }
+        return images;
+    }
+
+    /**
+     * @brief Load an image file, e.g. a golden image to compare screenshots with
+     *
+     * Returns nullptr if the file could not be read or the backend
+     * does not support loading images. Unlike the other methods, this
+     * is called on worker threads, so it must not access the scene.
+     */
+    virtual std::unique_ptr<Image> loadImage(const std::string&) { return {}; }
+
+    /**
+     * @brief Number of frames the window of the item has rendered so far
+     *
+     * Lets commands look at an item once per frame instead of on every
+     * check. Returns -1 if the backend does not count frames.
+     */
+    virtual long long renderedFrames(const ItemPath&) { return -1; }
+
+    /**
+     * @brief Number of changes so far that can change what the path resolves to
+     *
+     * Lets commands that wait for an item resolve its path again only after
+     * items were added, removed, renamed, shown or hidden. Returns -1 if the
+     * backend does not track changes for this path, so it has to be
+     * resolved on each check.
+     */
+    virtual long long itemTreeChanges(const ItemPath&) { return -1; }
+
+    /**
+     * @brief Number of changes so far of a property of the item at the path
+     *
+     * Lets commands that wait for a property value read it again only after
+     * the property notified a change, or after a change of the item tree
+     * that can make the path resolve to another item. Returns -1 if the
+     * backend cannot watch the property, e.g. because it has no change
+     * notification or the path does not resolve, so it has to be read on
+     * each check.
+     */
+    virtual long long propertyChanges(const ItemPath&, const std::string& /*propertyName*/) { return -1; }
+
+    /**
+     * @brief `propertyChanges` of several properties of the same item
+     *
+     * Backends can override this to resolve the path only once. The
+     * default implementation asks for each property on its own.
+     */
+    virtual std::vector<long long> propertyChanges(const ItemPath& path, const std::vector<std::string>& propertyNames)
+    {
+        std::vector<long long> changes;
+        changes.reserve(propertyNames.size());
+        for (const auto& propertyName : propertyNames) {
+            changes.push_back(propertyChanges(path, propertyName));
+        }
+        return changes;
+    }
+
+    /**
+     * @brief Start recording the frames of a window to a file
+     *
+     * Returns false if the window was not found, the file could not be
+     * opened, a recording is already running or the backend does not
+     * support recording.
+     */
+    virtual bool startRecording(const ItemPath&, int, const std::string&) { return false; }
+
+    /**
+     * @brief Stop capturing frames
+     *
+     * Returns the recorder, which still has to write the buffered frames,
+     * or nullptr if no recording is running.
+     */
+    virtual std::unique_ptr<FrameRecorder> stopRecording() { return {}; }
+
+    // Diagnostics
+
+    /**
+     * @brief Backend specific counters, e.g. about item lookups
+     *
+     * Backends without any counters return an empty map.
+     */
+    virtual Variant::MapType statistics() { return {}; }
 };
 
 } // namespace spix
@@ -7,14 +7,23 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <thread>
 
+#include <Spix/Data/CaptureMode.h>
+#include <Spix/Data/CaptureOptions.h>
 #include <Spix/Data/Geometry.h>
+#include <Spix/Data/ImageComparison.h>
+#include <Spix/Data/ImageHashAlgorithm.h>
+#include <Spix/Data/ImageEncoding.h>
 #include <Spix/Data/ItemPath.h>
+#include <Spix/Data/SharedImage.h>
 #include <Spix/Data/Variant.h>
 #include <Spix/Events/Identifiers.h>
+#include <Spix/Scene/FrameRecorder.h>
 
 #include <Spix/spix_core_export.h>
 
@@ -34,6 +43,10 @@ class CommandExecuter;
  *
  * The code in `executeTest` is executed in its own thread so that
  * it does not affect the execution of the main application.
+ *
+ * Commands that return a value block until the command was executed.
+ * Their `...Async` variants return a `std::future` instead, so that
+ * several queries can be issued before waiting for their results.
  */
 class SPIXCORE_EXPORT TestServer {
 public:
@@ -44,6 +57,16 @@ public:
 
     void setGenericCommandHandler(std::function<void(std::string, std::string)> handler);
 
+    /**
+     * @brief Execute the commands issued by `commands` as one group
+     *
+     * The commands are enqueued together once `commands` returns and are
+     * executed back to back, without commands of other clients in between.
+     * Use the `...Async` variants inside, results are only available after
+     * `commands` returned.
+     */
+    void runCommandGroup(const std::function<void()>& commands);
+
     // Commands
     void wait(std::chrono::milliseconds waitTime);
     void mouseClick(ItemPath path);
@@ -62,16 +85,66 @@ public:
 
     std::string getStringProperty(ItemPath path, std::string propertyName);
     void setStringProperty(ItemPath path, std::string propertyName, std::string propertyValue);
+    std::vector<Variant::MapType> getProperties(std::vector<ItemPath> paths, std::vector<std::string> propertyNames);
     Variant invokeMethod(ItemPath path, std::string method, std::vector<Variant> args);
     Rect getBoundingBox(ItemPath path);
     bool existsAndVisible(ItemPath path);
     std::vector<std::string> getErrors();
     bool waitForItem(ItemPath path, std::chrono::milliseconds maxWaitTime);
+    bool waitForProperty(
+        ItemPath path, std::string propertyName, Variant expectedValue, std::chrono::milliseconds maxWaitTime);
+    bool waitForStableFrame(ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime);
+    Variant::MapType getStatistics();
+    int subscribe(ItemPath path, std::vector<std::string> propertyNames,
+        std::chrono::milliseconds minInterval = std::chrono::milliseconds(100));
+    Variant::MapType waitForChanges(int subscriptionId, std::chrono::milliseconds maxWaitTime);
+    void unsubscribe(int subscriptionId);
 
     void takeScreenshot(ItemPath targetItem, std::string filePath);
     std::string takeScreenshotAsBase64(ItemPath targetItem);
+    EncodedImage takeScreenshotEncoded(ItemPath targetItem, ImageEncoding encoding,
+        CaptureMode captureMode = CaptureMode::Default, CaptureOptions options = {});
+    std::vector<EncodedImage> takeScreenshots(
+        std::vector<ItemPath> targetItems, ImageEncoding encoding, CaptureOptions options = {});
+    ImageComparison compareScreenshot(
+        ItemPath targetItem, std::string goldenFilePath, int tolerance, bool createDiffImage = false);
+    uint64_t getImageHash(ItemPath targetItem, ImageHashAlgorithm algorithm);
+    SharedImage takeScreenshotShared(ItemPath targetItem);
+    void releaseSharedScreenshot(std::string name);
+    bool startRecording(ItemPath windowPath, int fps, std::string filePath);
+    RecordingStatistics stopRecording();
     void quit();
 
+    // Async queries
+    std::future<std::string> getStringPropertyAsync(ItemPath path, std::string propertyName);
+    std::future<std::vector<Variant::MapType>> getPropertiesAsync(
+        std::vector<ItemPath> paths, std::vector<std::string> propertyNames);
+    std::future<Variant> invokeMethodAsync(ItemPath path, std::string method, std::vector<Variant> args);
+    std::future<Rect> getBoundingBoxAsync(ItemPath path);
+    std::future<bool> existsAndVisibleAsync(ItemPath path);
+    std::future<std::vector<std::string>> getErrorsAsync();
+    std::future<bool> waitForItemAsync(ItemPath path, std::chrono::milliseconds maxWaitTime);
+    std::future<bool> waitForPropertyAsync(
+        ItemPath path, std::string propertyName, Variant expectedValue, std::chrono::milliseconds maxWaitTime);
+    std::future<bool> waitForStableFrameAsync(
+        ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime);
+    std::future<Variant::MapType> getStatisticsAsync();
+    std::future<int> subscribeAsync(ItemPath path, std::vector<std::string> propertyNames,
+        std::chrono::milliseconds minInterval = std::chrono::milliseconds(100));
+    std::future<Variant::MapType> waitForChangesAsync(int subscriptionId, std::chrono::milliseconds maxWaitTime);
+    std::future<bool> takeScreenshotAsync(ItemPath targetItem, std::string filePath);
+    std::future<std::string> takeScreenshotAsBase64Async(ItemPath targetItem);
+    std::future<EncodedImage> takeScreenshotEncodedAsync(ItemPath targetItem, ImageEncoding encoding,
+        CaptureMode captureMode = CaptureMode::Default, CaptureOptions options = {});
+    std::future<std::vector<EncodedImage>> takeScreenshotsAsync(
+        std::vector<ItemPath> targetItems, ImageEncoding encoding, CaptureOptions options = {});
+    std::future<ImageComparison> compareScreenshotAsync(
+        ItemPath targetItem, std::string goldenFilePath, int tolerance, bool createDiffImage = false);
+    std::future<uint64_t> getImageHashAsync(ItemPath targetItem, ImageHashAlgorithm algorithm);
+    std::future<SharedImage> takeScreenshotSharedAsync(ItemPath targetItem);
+    std::future<bool> startRecordingAsync(ItemPath windowPath, int fps, std::string filePath);
+    std::future<RecordingStatistics> stopRecordingAsync();
+
 protected:
     virtual void executeTest() = 0;
 
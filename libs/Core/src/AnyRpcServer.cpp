@@ -7,20 +7,209 @@
 #include <Spix/AnyRpcServer.h>
 #include <Spix/Data/Variant.h>
 #include <Utils/AnyRpcFunction.h>
+#include <Utils/Base64.h>
 #include <atomic>
+#include <future>
+#include <stdexcept>
 
 namespace spix {
 
+namespace {
+
+std::unique_ptr<anyrpc::Server> MakeServer(AnyRpcServer::Transport transport, AnyRpcServer::Threading threading)
+{
+    if (threading == AnyRpcServer::Threading::ThreadPerConnection) {
+        switch (transport) {
+        case AnyRpcServer::Transport::JsonTcp:
+            return std::make_unique<anyrpc::JsonTcpServerMT>();
+        case AnyRpcServer::Transport::MessagePackTcp:
+            return std::make_unique<anyrpc::MessagePackTcpServerMT>();
+        case AnyRpcServer::Transport::XmlHttp:
+            break;
+        }
+        return std::make_unique<anyrpc::XmlHttpServerMT>();
+    }
+
+    switch (transport) {
+    case AnyRpcServer::Transport::JsonTcp:
+        return std::make_unique<anyrpc::JsonTcpServer>();
+    case AnyRpcServer::Transport::MessagePackTcp:
+        return std::make_unique<anyrpc::MessagePackTcpServer>();
+    case AnyRpcServer::Transport::XmlHttp:
+        break;
+    }
+    return std::make_unique<anyrpc::XmlHttpServer>();
+}
+
+ImageEncoding ParseImageEncoding(const std::string& encoding)
+{
+    try {
+        return ImageEncoding::fromString(encoding);
+    } catch (const std::invalid_argument& e) {
+        throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, e.what());
+    }
+}
+
+Variant::MapType EncodedImageToVariant(const EncodedImage& image)
+{
+    return {
+        {"data", utils::EncodeBase64(image.data)},
+        {"encoding", image.encoding.toString()},
+        {"width", static_cast<long long>(image.width)},
+        {"height", static_cast<long long>(image.height)},
+        {"size", static_cast<long long>(image.data.size())},
+        {"encodeTimeUs", static_cast<long long>(image.encodeTime.count())},
+    };
+}
+
+Variant::ListType EncodedImagesToVariant(const std::vector<EncodedImage>& images)
+{
+    Variant::ListType result;
+    for (const auto& image : images) {
+        result.emplace_back(EncodedImageToVariant(image));
+    }
+    return result;
+}
+
+Variant::MapType SharedImageToVariant(const SharedImage& image)
+{
+    return {
+        {"name", image.name},
+        {"width", static_cast<long long>(image.width)},
+        {"height", static_cast<long long>(image.height)},
+        {"stride", static_cast<long long>(image.stride)},
+        {"format", image.format},
+        {"size", static_cast<long long>(image.size)},
+    };
+}
+
+Variant::MapType ImageComparisonToVariant(const ImageComparison& comparison)
+{
+    const auto& region = comparison.changedRegion;
+    Variant::MapType result {
+        {"sizeMatches", comparison.sizeMatches},
+        {"mismatchedPixels", comparison.mismatchedPixels},
+        {"mismatchPercent", comparison.mismatchPercent},
+        {"changedRegion",
+            Variant::ListType {region.topLeft.x, region.topLeft.y, region.size.width, region.size.height}},
+    };
+    if (!comparison.diffImage.empty()) {
+        result["diffImage"] = utils::EncodeBase64(comparison.diffImage);
+    }
+    return result;
+}
+
+CaptureMode ParseCaptureMode(const std::string& captureMode)
+{
+    try {
+        return captureModeFromString(captureMode);
+    } catch (const std::invalid_argument& e) {
+        throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, e.what());
+    }
+}
+
+double ParseNumber(const Variant& value, const std::string& name)
+{
+    if (auto number = std::get_if<long long>(&value.base())) {
+        return static_cast<double>(*number);
+    }
+    if (auto number = std::get_if<double>(&value.base())) {
+        return *number;
+    }
+    throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, "Capture option is not a number: " + name);
+}
+
+// {captureMode: string, region: [x, y, width, height], maxWidth: int, maxHeight: int}, all optional
+CaptureOptions ParseCaptureOptions(const Variant& value, CaptureMode* captureMode = nullptr)
+{
+    auto map = std::get_if<Variant::MapType>(&value.base());
+    if (!map) {
+        throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, "Capture options have to be a map");
+    }
+
+    CaptureOptions options;
+    for (const auto& [name, option] : *map) {
+        if (name == "captureMode" && captureMode) {
+            auto mode = std::get_if<std::string>(&option.base());
+            *captureMode = ParseCaptureMode(mode ? *mode : "");
+        } else if (name == "region") {
+            auto region = std::get_if<Variant::ListType>(&option.base());
+            if (!region || region->size() != 4) {
+                throw anyrpc::AnyRpcException(
+                    anyrpc::AnyRpcErrorInvalidParams, "Capture region has to be [x, y, width, height]");
+            }
+            options.region = Rect(ParseNumber((*region)[0], name), ParseNumber((*region)[1], name),
+                ParseNumber((*region)[2], name), ParseNumber((*region)[3], name));
+        } else if (name == "maxWidth") {
+            options.maxWidth = static_cast<int>(ParseNumber(option, name));
+        } else if (name == "maxHeight") {
+            options.maxHeight = static_cast<int>(ParseNumber(option, name));
+        } else {
+            throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, "Unknown capture option: " + name);
+        }
+    }
+    return options;
+}
+
+ImageHashAlgorithm ParseImageHashAlgorithm(const std::string& algorithm)
+{
+    try {
+        return imageHashAlgorithmFromString(algorithm);
+    } catch (const std::invalid_argument& e) {
+        throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, e.what());
+    }
+}
+
+// XML-RPC has no 64 bit integers, so hashes are sent as hex strings
+std::string HashToHex(uint64_t hash)
+{
+    const char digits[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; --i, hash >>= 4) {
+        hex[i] = digits[hash & 0xf];
+    }
+    return hex;
+}
+
+Variant::MapType RecordingStatisticsToVariant(const RecordingStatistics& statistics)
+{
+    return {
+        {"frames", statistics.frames},
+        {"droppedFrames", statistics.droppedFrames},
+        {"bytesWritten", statistics.bytesWritten},
+        {"durationMs", static_cast<long long>(statistics.duration.count())},
+        {"averageCaptureTimeUs", static_cast<long long>(statistics.averageCaptureTime.count())},
+        {"maxCaptureTimeUs", static_cast<long long>(statistics.maxCaptureTime.count())},
+        {"averageEncodeTimeUs", static_cast<long long>(statistics.averageEncodeTime.count())},
+    };
+}
+
+// Converts the result of a query once it is available, without waiting for it here
+template <typename R, typename T, typename F>
+std::future<R> ConvertWhenReady(std::future<T> future, F convert)
+{
+    return std::async(std::launch::deferred,
+        [future = std::move(future), convert = std::move(convert)]() mutable { return R(convert(future.get())); });
+}
+
+template <typename R, typename T>
+std::future<R> ConvertWhenReady(std::future<T> future)
+{
+    return ConvertWhenReady<R>(std::move(future), [](T value) { return value; });
+}
+
+} // namespace
+
 struct AnyRpcServerPimpl {
     std::unique_ptr<anyrpc::Server> server;
     std::mutex serverAccessMutex;
     std::atomic<bool> keepRunning {true};
 };
 
-AnyRpcServer::AnyRpcServer(int anyrpcPort)
+AnyRpcServer::AnyRpcServer(int anyrpcPort, Transport transport, Threading threading)
 : m_pimpl(new AnyRpcServerPimpl())
 {
-    m_pimpl->server = std::make_unique<anyrpc::XmlHttpServer>();
+    m_pimpl->server = MakeServer(transport, threading);
 
     anyrpc::MethodManager* methodManager = m_pimpl->server->GetMethodManager();
 
@@ -77,10 +266,10 @@ AnyRpcServer::AnyRpcServer(int anyrpcPort)
         "Press and release a key | enterKey(string path, int keyCode, unsigned int keyModifier)",
         [this](std::string path, int keyCode, unsigned modifiers) { enterKey(std::move(path), keyCode, modifiers); });
 
-    utils::AddFunctionToAnyRpc<std::string(std::string, std::string)>(methodManager, "getStringProperty",
+    utils::AddFunctionToAnyRpc<std::future<std::string>(std::string, std::string)>(methodManager, "getStringProperty",
         "Return a property as string | getStringProperty(string path, string property) : string property_value",
         [this](std::string path, std::string property) {
-            return getStringProperty(std::move(path), std::move(property));
+            return getStringPropertyAsync(std::move(path), std::move(property));
         });
 
     utils::AddFunctionToAnyRpc<void(std::string, std::string, std::string)>(methodManager, "setStringProperty",
@@ -90,32 +279,89 @@ AnyRpcServer::AnyRpcServer(int anyrpcPort)
             setStringProperty(std::move(path), std::move(property), std::move(value));
         });
 
-    utils::AddFunctionToAnyRpc<Variant(std::string, std::string, std::vector<Variant>)>(methodManager, "invokeMethod",
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::vector<std::string>, std::vector<std::string>)>(methodManager,
+        "getProperties",
+        "Return several properties of several objects with their types | getProperties(string[] paths, string[] "
+        "properties) : [{string property: any value, ...}, ...]",
+        [this](std::vector<std::string> paths, std::vector<std::string> properties) {
+            auto values = getPropertiesAsync(std::vector<ItemPath>(paths.begin(), paths.end()), std::move(properties));
+            return ConvertWhenReady<Variant>(std::move(values), [](std::vector<Variant::MapType> result) {
+                return Variant::ListType(result.begin(), result.end());
+            });
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string, std::vector<Variant>)>(methodManager,
+        "invokeMethod",
         "Invoke a method on a QML object | invokeMethod(string path, string method, any[] args)",
         [this](std::string path, std::string method, std::vector<Variant> args) {
-            return invokeMethod(std::move(path), std::move(method), std::move(args));
+            return invokeMethodAsync(std::move(path), std::move(method), std::move(args));
         });
 
-    utils::AddFunctionToAnyRpc<std::vector<double>(std::string)>(methodManager, "getBoundingBox",
+    utils::AddFunctionToAnyRpc<std::future<std::vector<double>>(std::string)>(methodManager, "getBoundingBox",
         "Return the bounding box of an item in screen coordinates | getBoundingBox(string path) : (doubles) "
         "[topLeft.x, topLeft.y , width, height]",
         [this](std::string path) {
-            auto bounds = getBoundingBox(std::move(path));
-            return std::vector<double> {bounds.topLeft.x, bounds.topLeft.y, bounds.size.width, bounds.size.height};
+            return ConvertWhenReady<std::vector<double>>(getBoundingBoxAsync(std::move(path)), [](Rect bounds) {
+                return std::vector<double> {
+                    bounds.topLeft.x, bounds.topLeft.y, bounds.size.width, bounds.size.height};
+            });
         });
 
-    utils::AddFunctionToAnyRpc<bool(std::string)>(methodManager, "existsAndVisible",
+    utils::AddFunctionToAnyRpc<std::future<bool>(std::string)>(methodManager, "existsAndVisible",
         "Returns true if the given object exists | existsAndVisible(string path) : bool exists_and_visible",
-        [this](std::string path) { return existsAndVisible(std::move(path)); });
+        [this](std::string path) { return existsAndVisibleAsync(std::move(path)); });
 
-    utils::AddFunctionToAnyRpc<bool(std::string, int)>(methodManager, "waitForItem",
+    utils::AddFunctionToAnyRpc<std::future<bool>(std::string, int)>(methodManager, "waitForItem",
         "Returns true if the given object exists and the time is not expired | waitForItem(string path, int "
         "millisecondsToWait) : bool exists_and_visible",
-        [this](std::string path, int ms) { return waitForItem(std::move(path), std::chrono::milliseconds(ms)); });
+        [this](std::string path, int ms) {
+            return waitForItemAsync(std::move(path), std::chrono::milliseconds(ms));
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<bool>(std::string, std::string, Variant, int)>(methodManager,
+        "waitForProperty",
+        "Wait until the property of the object has the expected value. Strings are compared with the property as "
+        "string | waitForProperty(string path, string propertyName, expectedValue, int millisecondsToWait) : bool "
+        "matched",
+        [this](std::string path, std::string propertyName, Variant expectedValue, int ms) {
+            return waitForPropertyAsync(std::move(path), std::move(propertyName), std::move(expectedValue),
+                std::chrono::milliseconds(ms));
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<bool>(std::string, int, int)>(methodManager, "waitForStableFrame",
+        "Wait until the object looks the same for a number of rendered frames, e.g. after an animation | "
+        "waitForStableFrame(string path, int consecutiveFrames, int millisecondsToWait) : bool stable",
+        [this](std::string path, int consecutiveFrames, int ms) {
+            return waitForStableFrameAsync(std::move(path), consecutiveFrames, std::chrono::milliseconds(ms));
+        });
 
-    utils::AddFunctionToAnyRpc<std::vector<std::string>()>(methodManager, "getErrors",
+    utils::AddFunctionToAnyRpc<std::future<int>(std::string, std::vector<std::string>, int)>(methodManager, "subscribe",
+        "Subscribe to changes of properties of the object, sent at most every minIntervalMs | subscribe(string path, "
+        "strings propertyNames, int minIntervalMs) : int subscriptionId",
+        [this](std::string path, std::vector<std::string> propertyNames, int minIntervalMs) {
+            return subscribeAsync(
+                std::move(path), std::move(propertyNames), std::chrono::milliseconds(minIntervalMs));
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(int, int)>(methodManager, "waitForChanges",
+        "Wait until properties of a subscription changed. The first call returns all properties | "
+        "waitForChanges(int subscriptionId, int millisecondsToWait) : {propertyName: value, ...} changes",
+        [this](int subscriptionId, int ms) {
+            return ConvertWhenReady<Variant>(waitForChangesAsync(subscriptionId, std::chrono::milliseconds(ms)));
+        });
+
+    utils::AddFunctionToAnyRpc<void(int)>(methodManager, "unsubscribe",
+        "Remove a subscription | unsubscribe(int subscriptionId)",
+        [this](int subscriptionId) { unsubscribe(subscriptionId); });
+
+    utils::AddFunctionToAnyRpc<std::future<std::vector<std::string>>()>(methodManager, "getErrors",
         "Returns internal errors that occurred during test execution | getErrors() : (strings) [error1, ...]",
-        [this]() { return getErrors(); });
+        [this]() { return getErrorsAsync(); });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>()>(methodManager, "getStatistics",
+        "Returns diagnostic counters of the scene, e.g. item lookup cache hits | getStatistics() : {string name: "
+        "any value, ...}",
+        [this]() { return ConvertWhenReady<Variant>(getStatisticsAsync()); });
 
     utils::AddFunctionToAnyRpc<void(std::string, std::string)>(methodManager, "takeScreenshot",
         "Take a screenshot of the object and save it as a file | takeScreenshot(string pathToTargetedItem, string "
@@ -124,9 +370,118 @@ AnyRpcServer::AnyRpcServer(int anyrpcPort)
             return takeScreenshot(std::move(targetItem), std::move(filePath));
         });
 
-    utils::AddFunctionToAnyRpc<std::string(std::string)>(methodManager, "takeScreenshotAsBase64",
+    utils::AddFunctionToAnyRpc<std::future<std::string>(std::string)>(methodManager, "takeScreenshotAsBase64",
         "Take a screenshot of the object and send as base64 string | takeScreenshotAsBase64(string pathToTargetedItem)",
-        [this](std::string targetItem) { return takeScreenshotAsBase64(std::move(targetItem)); });
+        [this](std::string targetItem) { return takeScreenshotAsBase64Async(std::move(targetItem)); });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string)>(methodManager, "takeScreenshotEncoded",
+        "Take a screenshot of the object with the given encoding, e.g. 'raw', 'qoi', 'png:1' or 'jpeg:85' | "
+        "takeScreenshotEncoded(string pathToTargetedItem, string encoding) : {string data (base64), string "
+        "encoding, int width, int height, int size, int encodeTimeUs}",
+        [this](std::string targetItem, std::string encoding) {
+            auto image = takeScreenshotEncodedAsync(std::move(targetItem), ParseImageEncoding(encoding));
+            return ConvertWhenReady<Variant>(std::move(image), EncodedImageToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string, std::string)>(methodManager,
+        "takeScreenshotEncodedWithMode",
+        "Take a screenshot of the object, either cropped from its window ('window') or by rendering only the object "
+        "('item') | takeScreenshotEncodedWithMode(string pathToTargetedItem, string encoding, string captureMode) : "
+        "{string data (base64), string encoding, int width, int height, int size, int encodeTimeUs}",
+        [this](std::string targetItem, std::string encoding, std::string captureMode) {
+            auto image = takeScreenshotEncodedAsync(
+                std::move(targetItem), ParseImageEncoding(encoding), ParseCaptureMode(captureMode));
+            return ConvertWhenReady<Variant>(std::move(image), EncodedImageToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string, Variant)>(methodManager,
+        "takeScreenshotEncodedWithOptions",
+        "Take a screenshot of a region of the object, scaled down to a maximum size | "
+        "takeScreenshotEncodedWithOptions(string pathToTargetedItem, string encoding, {string captureMode, (doubles) "
+        "region [x, y, width, height], int maxWidth, int maxHeight}) : {string data (base64), string encoding, int "
+        "width, int height, int size, int encodeTimeUs}",
+        [this](std::string targetItem, std::string encoding, Variant options) {
+            auto captureMode = CaptureMode::Default;
+            auto captureOptions = ParseCaptureOptions(options, &captureMode);
+            auto image = takeScreenshotEncodedAsync(
+                std::move(targetItem), ParseImageEncoding(encoding), captureMode, captureOptions);
+            return ConvertWhenReady<Variant>(std::move(image), EncodedImageToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::vector<std::string>, std::string)>(methodManager,
+        "takeScreenshots",
+        "Take screenshots of several objects, grabbing each window only once | takeScreenshots(string[] "
+        "pathsToTargetedItems, string encoding) : [{string data (base64), string encoding, int width, int height, "
+        "int size, int encodeTimeUs}, ...]",
+        [this](std::vector<std::string> targetItems, std::string encoding) {
+            auto images = takeScreenshotsAsync(
+                std::vector<ItemPath>(targetItems.begin(), targetItems.end()), ParseImageEncoding(encoding));
+            return ConvertWhenReady<Variant>(std::move(images), EncodedImagesToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::vector<std::string>, std::string, Variant)>(methodManager,
+        "takeScreenshotsWithOptions",
+        "Take screenshots of the same region of several objects, scaled down to a maximum size | "
+        "takeScreenshotsWithOptions(string[] pathsToTargetedItems, string encoding, {(doubles) region [x, y, width, "
+        "height], int maxWidth, int maxHeight}) : [{string data (base64), string encoding, int width, int height, "
+        "int size, int encodeTimeUs}, ...]",
+        [this](std::vector<std::string> targetItems, std::string encoding, Variant options) {
+            auto images = takeScreenshotsAsync(std::vector<ItemPath>(targetItems.begin(), targetItems.end()),
+                ParseImageEncoding(encoding), ParseCaptureOptions(options));
+            return ConvertWhenReady<Variant>(std::move(images), EncodedImagesToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string, int)>(methodManager, "compareScreenshot",
+        "Compare a screenshot of the object with a golden image file and return the differences | "
+        "compareScreenshot(string pathToTargetedItem, string goldenFilePath, int tolerance) : {bool sizeMatches, int "
+        "mismatchedPixels, double mismatchPercent, (doubles) changedRegion [x, y, width, height]}",
+        [this](std::string targetItem, std::string goldenFilePath, int tolerance) {
+            auto comparison = compareScreenshotAsync(std::move(targetItem), std::move(goldenFilePath), tolerance);
+            return ConvertWhenReady<Variant>(std::move(comparison), ImageComparisonToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string, std::string, int)>(methodManager,
+        "compareScreenshotWithDiff",
+        "Like compareScreenshot, but also return an image of the differences | compareScreenshotWithDiff(string "
+        "pathToTargetedItem, string goldenFilePath, int tolerance) : {..., string diffImage (base64 QOI)}",
+        [this](std::string targetItem, std::string goldenFilePath, int tolerance) {
+            auto comparison =
+                compareScreenshotAsync(std::move(targetItem), std::move(goldenFilePath), tolerance, true);
+            return ConvertWhenReady<Variant>(std::move(comparison), ImageComparisonToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<std::string>(std::string, std::string)>(methodManager, "getImageHash",
+        "Return a hash of the object's content, 'xxhash' (exact), 'dhash' or 'phash' (perceptual) | "
+        "getImageHash(string pathToTargetedItem, string algorithm) : string hash (16 hex digits)",
+        [this](std::string targetItem, std::string algorithm) {
+            auto hash = getImageHashAsync(std::move(targetItem), ParseImageHashAlgorithm(algorithm));
+            return ConvertWhenReady<std::string>(std::move(hash), HashToHex);
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>(std::string)>(methodManager, "takeScreenshotShared",
+        "Write the raw pixels of a screenshot to shared memory, for clients on the same machine | "
+        "takeScreenshotShared(string pathToTargetedItem) : {string name, int width, int height, int stride, string "
+        "format, int size}",
+        [this](std::string targetItem) {
+            return ConvertWhenReady<Variant>(takeScreenshotSharedAsync(std::move(targetItem)), SharedImageToVariant);
+        });
+
+    utils::AddFunctionToAnyRpc<void(std::string)>(methodManager, "releaseSharedScreenshot",
+        "Remove a screenshot from shared memory after reading it | releaseSharedScreenshot(string name)",
+        [this](std::string name) { releaseSharedScreenshot(std::move(name)); });
+
+    utils::AddFunctionToAnyRpc<std::future<bool>(std::string, int, std::string)>(methodManager, "startRecording",
+        "Start recording the frames of a window to a file | startRecording(string pathToWindow, int fps, string "
+        "filePath) : bool started",
+        [this](std::string windowPath, int fps, std::string filePath) {
+            return startRecordingAsync(std::move(windowPath), fps, std::move(filePath));
+        });
+
+    utils::AddFunctionToAnyRpc<std::future<Variant>()>(methodManager, "stopRecording",
+        "Stop the recording and wait until all frames are written | stopRecording() : {int frames, int "
+        "droppedFrames, int bytesWritten, int durationMs, int averageCaptureTimeUs, int maxCaptureTimeUs, int "
+        "averageEncodeTimeUs}",
+        [this]() { return ConvertWhenReady<Variant>(stopRecordingAsync(), RecordingStatisticsToVariant); });
 
     utils::AddFunctionToAnyRpc<void()>(methodManager, "quit", "Close the app | quit()", [this] { quit(); });
 
@@ -134,6 +489,11 @@ AnyRpcServer::AnyRpcServer(int anyrpcPort)
         "Executes a generic/custom command | command(string command, string payload)",
         [this](std::string command, std::string payload) { genericCommand(command, payload); });
 
+    methodManager->AddMethod(new utils::AnyRpcBatchFunction(
+        methodManager, [this](const std::function<void()>& calls) { runCommandGroup(calls); }, "batch",
+        "Execute several calls in one request, without commands of other clients in between | batch([{string "
+        "method, any[] params}, ...]) : [{any result} or {string error}, ...]"));
+
     m_pimpl->server->BindAndListen(anyrpcPort);
 }
 
@@ -6,11 +6,18 @@
 
 #include <Spix/CommandExecuter/CommandEnvironment.h>
 
+#include <algorithm>
+
 namespace spix {
 
-CommandEnvironment::CommandEnvironment(Scene& scene, ExecuterState& state)
+CommandEnvironment::CommandEnvironment(Scene& scene, ExecuterState& state, WorkerPool& workers,
+    ImageCache& imageCache, SharedImageStore& sharedImages, SubscriptionStore& subscriptions)
 : m_scene(scene)
 , m_state(state)
+, m_workers(workers)
+, m_imageCache(imageCache)
+, m_sharedImages(sharedImages)
+, m_subscriptions(subscriptions)
 {
 }
 
@@ -24,4 +31,42 @@ ExecuterState& CommandEnvironment::state()
     return m_state;
 }
 
+WorkerPool& CommandEnvironment::workers()
+{
+    return m_workers;
+}
+
+ImageCache& CommandEnvironment::imageCache()
+{
+    return m_imageCache;
+}
+
+SharedImageStore& CommandEnvironment::sharedImages()
+{
+    return m_sharedImages;
+}
+
+SubscriptionStore& CommandEnvironment::subscriptions()
+{
+    return m_subscriptions;
+}
+
+void CommandEnvironment::wakeUpAt(std::chrono::steady_clock::time_point deadline)
+{
+    m_nextWakeUp = std::min(m_nextWakeUp, deadline);
+    m_wakeUpScheduled = true;
+}
+
+std::chrono::steady_clock::time_point CommandEnvironment::nextWakeUp() const
+{
+    return m_nextWakeUp;
+}
+
+bool CommandEnvironment::takeWakeUpScheduled()
+{
+    bool scheduled = m_wakeUpScheduled;
+    m_wakeUpScheduled = false;
+    return scheduled;
+}
+
 } // namespace spix
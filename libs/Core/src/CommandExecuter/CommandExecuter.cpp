@@ -7,14 +7,53 @@
 #include <Spix/CommandExecuter/CommandEnvironment.h>
 #include <Spix/CommandExecuter/CommandExecuter.h>
 
+#include <Commands/CommandGroup.h>
+
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 namespace spix {
 
+namespace {
+
+// Screenshots are encoded on two threads, with at most four
+// images waiting for or being encoded at a time.
+constexpr unsigned workerThreadCount = 2;
+constexpr unsigned maxWorkerJobs = 4;
+
+// Memory for decoded golden images, about 30 full HD windows
+constexpr size_t maxImageCacheBytes = 256 * 1024 * 1024;
+
+// Screenshots in shared memory that the clients did not release yet
+constexpr size_t maxSharedImages = 16;
+
+// Property subscriptions that the clients did not unsubscribe yet
+constexpr size_t maxSubscriptions = 64;
+
+// Commands collected by enqueueCommandGroup on this thread
+struct CollectedGroup {
+    CommandExecuter* executer;
+    std::vector<std::unique_ptr<cmd::Command>> commands;
+};
+thread_local CollectedGroup* collectedGroup = nullptr;
+
+} // namespace
+
 CommandExecuter::CommandExecuter()
 : m_mainThreadId(std::this_thread::get_id())
 , m_commandQueue()
+, m_imageCache(maxImageCacheBytes)
+, m_sharedImages(maxSharedImages)
+, m_subscriptions(maxSubscriptions)
+, m_workers(workerThreadCount, maxWorkerJobs)
 {
+    // a finished job frees capacity that waiting commands might need
+    m_workers.setJobFinishedHandler([this] {
+        if (m_wakeupHandler && !m_wakeupPending.exchange(true)) {
+            m_wakeupHandler();
+        }
+    });
 }
 
 ExecuterState& CommandExecuter::state()
@@ -24,10 +63,47 @@ ExecuterState& CommandExecuter::state()
     return m_state;
 }
 
+void CommandExecuter::setWakeupHandler(WakeupHandler handler)
+{
+    m_wakeupHandler = std::move(handler);
+}
+
 void CommandExecuter::enqueueCommand(std::unique_ptr<cmd::Command> command)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_commandQueue.emplace(std::move(command));
+    if (collectedGroup && collectedGroup->executer == this) {
+        collectedGroup->commands.push_back(std::move(command));
+        return;
+    }
+
+    m_commandQueue.push(std::move(command), std::this_thread::get_id());
+
+    // Only wake up the main thread once per processCommands() call
+    if (m_wakeupHandler && !m_wakeupPending.exchange(true)) {
+        m_wakeupHandler();
+    }
+}
+
+void CommandExecuter::enqueueCommandGroup(const std::function<void()>& enqueueCommands)
+{
+    // a nested group becomes part of the outer one
+    if (collectedGroup && collectedGroup->executer == this) {
+        enqueueCommands();
+        return;
+    }
+
+    CollectedGroup group {this, {}};
+    collectedGroup = &group;
+    try {
+        enqueueCommands();
+    } catch (...) {
+        collectedGroup = nullptr;
+        throw;
+    }
+    collectedGroup = nullptr;
+
+    if (!group.commands.empty()) {
+        enqueueCommand(std::make_unique<cmd::CommandGroup>(std::move(group.commands)));
+    }
 }
 
 void CommandExecuter::processCommands(Scene& scene)
@@ -35,29 +111,100 @@ void CommandExecuter::processCommands(Scene& scene)
     // main thread access only
     assert(m_mainThreadId == std::this_thread::get_id());
 
-    std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
-    if (!lock) {
-        return;
+    // Reset before looking at the queue, so that a producer that is pushing
+    // right now wakes us up again after its command became visible.
+    m_wakeupPending.store(false);
+
+    for (auto& error : m_workers.takeErrors()) {
+        m_state.reportError(error);
+    }
+
+    CommandEnvironment env(scene, m_state, m_workers, m_imageCache, m_sharedImages, m_subscriptions);
+
+    // Each waiting command is asked once per call if it can execute now
+    for (auto& lane : m_lanes) {
+        lane.waiting = false;
     }
+    m_needsPolling = false;
 
-    CommandEnvironment env(scene, m_state);
+    // Commands can enqueue further commands while they execute
+    bool executedCommands = false;
+    do {
+        takeQueuedCommands();
+        executedCommands = executeLanes(env);
+    } while (executedCommands && !m_commandQueue.empty());
+    m_nextDeadline = env.nextWakeUp();
 
-    while (!m_commandQueue.empty()) {
-        auto& queuedCmd = m_commandQueue.front();
+    m_lanes.remove_if([](const Lane& lane) { return lane.commands.empty(); });
+}
+
+bool CommandExecuter::hasPendingCommands()
+{
+    // main thread access only
+    assert(m_mainThreadId == std::this_thread::get_id());
 
-        if (!queuedCmd->canExecuteNow(env))
-            break;
+    return !m_commandQueue.empty() || !m_lanes.empty();
+}
 
-        // We can execute the command now.
-        // Remove from queue and execute.
-        std::unique_ptr<cmd::Command> localCmd = std::move(queuedCmd);
-        m_commandQueue.pop();
+std::chrono::milliseconds CommandExecuter::nextCheckDelay(std::chrono::milliseconds pollingInterval)
+{
+    // main thread access only
+    assert(m_mainThreadId == std::this_thread::get_id());
 
-        lock.unlock();
-        localCmd->execute(env);
-        if (!lock.try_lock()) {
-            return;
+    if (m_nextDeadline == std::chrono::steady_clock::time_point::max()) {
+        return pollingInterval;
+    }
+
+    auto untilDeadline
+        = std::chrono::ceil<std::chrono::milliseconds>(m_nextDeadline - std::chrono::steady_clock::now());
+    untilDeadline = std::max(untilDeadline, std::chrono::milliseconds(0));
+    return m_needsPolling ? std::min(untilDeadline, pollingInterval) : untilDeadline;
+}
+
+void CommandExecuter::takeQueuedCommands()
+{
+    while (m_commandQueue.front()) {
+        auto laneId = m_commandQueue.frontLane();
+        auto lane = std::find_if(
+            m_lanes.begin(), m_lanes.end(), [&](const Lane& candidate) { return candidate.id == laneId; });
+        if (lane == m_lanes.end()) {
+            lane = m_lanes.insert(m_lanes.end(), Lane {laneId, {}});
         }
+        lane->commands.push_back({m_nextSequence++, m_commandQueue.pop()});
+    }
+}
+
+bool CommandExecuter::executeLanes(CommandEnvironment& env)
+{
+    // Execute the oldest command of all lanes that are not waiting, so that
+    // commands run in the order they were enqueued unless one of them waits.
+    bool executedCommands = false;
+    while (true) {
+        Lane* next = nullptr;
+        for (auto& lane : m_lanes) {
+            if (!lane.waiting && !lane.commands.empty()
+                && (!next || lane.commands.front().sequence < next->commands.front().sequence)) {
+                next = &lane;
+            }
+        }
+        if (!next) {
+            return executedCommands;
+        }
+
+        bool canExecute = next->commands.front().command->canExecuteNow(env);
+        bool wakeUpScheduled = env.takeWakeUpScheduled();
+        if (!canExecute) {
+            next->waiting = true;
+            m_needsPolling = m_needsPolling || !wakeUpScheduled;
+            continue;
+        }
+
+        // Executing may enqueue commands, which are only taken from the queue
+        // afterwards, so `next` stays valid.
+        auto command = std::move(next->commands.front().command);
+        next->commands.pop_front();
+        command->execute(env);
+        executedCommands = true;
     }
 }
 
@@ -0,0 +1,70 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/CommandExecuter/CommandQueue.h>
+
+namespace spix {
+
+CommandQueue::CommandQueue()
+: m_back(new Node())
+, m_front(m_back.load())
+{
+}
+
+CommandQueue::~CommandQueue()
+{
+    while (m_front) {
+        Node* next = m_front->next.load();
+        delete m_front;
+        m_front = next;
+    }
+}
+
+void CommandQueue::push(std::unique_ptr<cmd::Command> command, Lane lane)
+{
+    Node* node = new Node();
+    node->command = std::move(command);
+    node->lane = lane;
+
+    // Producers only contend on the exchange. Until the previous node is
+    // linked below, the consumer sees the queue as ending before `node`.
+    Node* previous = m_back.exchange(node);
+    previous->next.store(node);
+}
+
+cmd::Command* CommandQueue::front() const
+{
+    Node* next = m_front->next.load();
+    return next ? next->command.get() : nullptr;
+}
+
+CommandQueue::Lane CommandQueue::frontLane() const
+{
+    Node* next = m_front->next.load();
+    return next ? next->lane : Lane();
+}
+
+std::unique_ptr<cmd::Command> CommandQueue::pop()
+{
+    Node* next = m_front->next.load();
+    if (!next) {
+        return nullptr;
+    }
+
+    // `next` becomes the new front node
+    std::unique_ptr<cmd::Command> command = std::move(next->command);
+    delete m_front;
+    m_front = next;
+
+    return command;
+}
+
+bool CommandQueue::empty() const
+{
+    return m_front->next.load() == nullptr;
+}
+
+} // namespace spix
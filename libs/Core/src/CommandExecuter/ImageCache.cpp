@@ -0,0 +1,90 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/CommandExecuter/ImageCache.h>
+
+#include <iterator>
+
+namespace spix {
+
+namespace {
+
+std::filesystem::file_time_type ModificationTime(const std::string& filePath)
+{
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(filePath, error);
+    return error ? std::filesystem::file_time_type::min() : time;
+}
+
+} // namespace
+
+ImageCache::ImageCache(size_t maxBytes)
+: m_maxBytes(maxBytes)
+{
+}
+
+std::shared_ptr<const RgbaImage> ImageCache::find(const std::string& filePath)
+{
+    auto modificationTime = ModificationTime(filePath);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_entriesByPath.find(filePath);
+    if (found == m_entriesByPath.end()) {
+        return {};
+    }
+
+    auto entry = found->second;
+    if (entry->modificationTime != modificationTime) {
+        erase(entry);
+        return {};
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    return entry->image;
+}
+
+void ImageCache::insert(const std::string& filePath, std::shared_ptr<const RgbaImage> image)
+{
+    auto modificationTime = ModificationTime(filePath);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_entriesByPath.find(filePath);
+    if (found != m_entriesByPath.end()) {
+        erase(found->second);
+    }
+
+    m_bytes += image->pixels.size();
+    m_entries.push_front(Entry {filePath, modificationTime, std::move(image)});
+    m_entriesByPath[filePath] = m_entries.begin();
+
+    // always keep the newest image, even if it is larger than the limit
+    while (m_bytes > m_maxBytes && m_entries.size() > 1) {
+        erase(std::prev(m_entries.end()));
+    }
+}
+
+void ImageCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_entriesByPath.clear();
+    m_bytes = 0;
+}
+
+size_t ImageCache::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void ImageCache::erase(Entries::iterator entry)
+{
+    m_bytes -= entry->image->pixels.size();
+    m_entriesByPath.erase(entry->filePath);
+    m_entries.erase(entry);
+}
+
+} // namespace spix
@@ -0,0 +1,83 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/CommandExecuter/SharedImageStore.h>
+
+#include <Spix/Scene/Image.h>
+#include <Utils/SharedMemory.h>
+
+#include <algorithm>
+
+namespace spix {
+
+SharedImageStore::SharedImageStore(size_t maxImages)
+: m_maxImages(maxImages)
+{
+}
+
+SharedImageStore::~SharedImageStore() = default;
+
+SharedImage SharedImageStore::publish(const Image& source)
+{
+    SharedImage image;
+    const auto width = source.width();
+    const auto height = source.height();
+    if (width <= 0 || height <= 0) {
+        return image;
+    }
+
+    const auto stride = static_cast<size_t>(width) * 4;
+    auto memory = utils::SharedMemory::create(stride * height);
+    if (!memory) {
+        return image;
+    }
+    source.writeRgbaPixels(0, 0, width, height, memory->data(), stride);
+
+    image.name = memory->name();
+    image.width = width;
+    image.height = height;
+    image.stride = static_cast<int>(stride);
+    image.format = "rgba8888";
+    image.size = memory->size();
+
+    // removed outside of the lock, unmapping large segments takes a moment
+    std::unique_ptr<utils::SharedMemory> evicted;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_segments.push_back(std::move(memory));
+        if (m_segments.size() > m_maxImages) {
+            evicted = std::move(m_segments.front());
+            m_segments.pop_front();
+        }
+    }
+
+    return image;
+}
+
+bool SharedImageStore::release(const std::string& name)
+{
+    std::unique_ptr<utils::SharedMemory> released;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto segment = std::find_if(m_segments.begin(), m_segments.end(),
+            [&name](const std::unique_ptr<utils::SharedMemory>& memory) { return memory->name() == name; });
+        if (segment == m_segments.end()) {
+            return false;
+        }
+        released = std::move(*segment);
+        m_segments.erase(segment);
+    }
+
+    return true;
+}
+
+size_t SharedImageStore::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_segments.size();
+}
+
+} // namespace spix
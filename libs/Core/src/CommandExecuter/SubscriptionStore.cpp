@@ -0,0 +1,49 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+
+namespace spix {
+
+SubscriptionStore::SubscriptionStore(size_t maxSubscriptions)
+: m_maxSubscriptions(maxSubscriptions)
+{
+}
+
+int SubscriptionStore::add(
+    ItemPath path, std::vector<std::string> properties, std::chrono::milliseconds minInterval)
+{
+    Subscription subscription;
+    subscription.path = std::move(path);
+    subscription.properties = std::move(properties);
+    subscription.minInterval = minInterval;
+
+    auto id = m_nextId++;
+    m_subscriptions.emplace(id, std::move(subscription));
+    if (m_subscriptions.size() > m_maxSubscriptions) {
+        m_subscriptions.erase(m_subscriptions.begin());
+    }
+
+    return id;
+}
+
+SubscriptionStore::Subscription* SubscriptionStore::find(int id)
+{
+    auto subscription = m_subscriptions.find(id);
+    return subscription != m_subscriptions.end() ? &subscription->second : nullptr;
+}
+
+bool SubscriptionStore::remove(int id)
+{
+    return m_subscriptions.erase(id) > 0;
+}
+
+size_t SubscriptionStore::size() const
+{
+    return m_subscriptions.size();
+}
+
+} // namespace spix
@@ -0,0 +1,123 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+
+#include <exception>
+
+namespace spix {
+
+WorkerPool::WorkerPool(unsigned threadCount, unsigned maxJobs)
+: m_threadCount(threadCount)
+, m_maxJobs(maxJobs)
+{
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobAvailable.notify_all();
+
+    // the threads finish all queued jobs before they exit
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::setJobFinishedHandler(JobFinishedHandler handler)
+{
+    m_jobFinishedHandler = std::move(handler);
+}
+
+bool WorkerPool::hasCapacity()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_jobs.size() + m_runningJobs + m_reservedJobs < m_maxJobs;
+}
+
+void WorkerPool::post(Job job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+
+        if (m_threads.size() < m_threadCount && m_threads.size() < m_jobs.size() + m_runningJobs) {
+            m_threads.emplace_back([this] { run(); });
+        }
+    }
+    m_jobAvailable.notify_one();
+}
+
+void WorkerPool::reserve()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_reservedJobs;
+}
+
+void WorkerPool::postReserved(Job job)
+{
+    cancelReservation();
+    post(std::move(job));
+}
+
+void WorkerPool::cancelReservation()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_reservedJobs > 0) {
+        --m_reservedJobs;
+    }
+}
+
+void WorkerPool::reportError(std::string error)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_errors.push_back(std::move(error));
+}
+
+std::vector<std::string> WorkerPool::takeErrors()
+{
+    std::vector<std::string> errors;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    errors.swap(m_errors);
+    return errors;
+}
+
+void WorkerPool::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_jobAvailable.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+        if (m_jobs.empty()) {
+            return;
+        }
+
+        auto job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        ++m_runningJobs;
+
+        lock.unlock();
+        try {
+            job();
+        } catch (const std::exception& e) {
+            reportError(e.what());
+        }
+        // release whatever the job captured before it counts as done
+        job = nullptr;
+        lock.lock();
+
+        --m_runningJobs;
+        if (m_jobFinishedHandler) {
+            lock.unlock();
+            m_jobFinishedHandler();
+            lock.lock();
+        }
+    }
+}
+
+} // namespace spix
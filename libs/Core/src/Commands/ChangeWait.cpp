@@ -0,0 +1,44 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ChangeWait.h"
+
+namespace spix {
+namespace cmd {
+
+ChangeWait::ChangeWait(std::chrono::milliseconds maxWaitTime)
+: m_maxWaitTime(std::move(maxWaitTime))
+{
+}
+
+bool ChangeWait::isOver(CommandEnvironment& env, long long changes, const std::function<bool()>& condition)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!m_timerInitialized) {
+        m_timerInitialized = true;
+        m_startTime = now;
+    }
+
+    if (changes < 0 || changes != m_lastChanges) {
+        m_lastChanges = changes;
+        if (condition()) {
+            return true;
+        }
+    }
+
+    auto deadline = m_startTime + m_maxWaitTime;
+    if (now >= deadline) {
+        return true;
+    }
+    // only arm the deadline when changes are tracked, otherwise the executer keeps polling
+    if (changes >= 0) {
+        env.wakeUpAt(deadline);
+    }
+    return false;
+}
+
+} // namespace cmd
+} // namespace spix
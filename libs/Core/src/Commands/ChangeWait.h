@@ -0,0 +1,38 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/CommandExecuter/CommandEnvironment.h>
+
+#include <chrono>
+#include <functional>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Timeout and change tracking of the commands waiting for a condition
+ *
+ * The condition is only checked again after the scene reported a change,
+ * or on each check if the scene does not track changes (-1).
+ */
+class ChangeWait {
+public:
+    explicit ChangeWait(std::chrono::milliseconds maxWaitTime);
+
+    /// Returns true once `condition` returned true or the wait timed out
+    bool isOver(CommandEnvironment& env, long long changes, const std::function<bool()>& condition);
+
+private:
+    bool m_timerInitialized = false;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::milliseconds m_maxWaitTime;
+    long long m_lastChanges = -1;
+};
+
+} // namespace cmd
+} // namespace spix
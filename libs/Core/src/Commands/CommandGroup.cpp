@@ -0,0 +1,41 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "CommandGroup.h"
+
+namespace spix {
+namespace cmd {
+
+CommandGroup::CommandGroup(std::vector<std::unique_ptr<Command>> commands)
+: m_commands(std::move(commands))
+{
+}
+
+void CommandGroup::execute(CommandEnvironment& env)
+{
+    if (!m_commands.empty()) {
+        m_commands.back()->execute(env);
+    }
+}
+
+bool CommandGroup::canExecuteNow(CommandEnvironment& env)
+{
+    // All commands but the last one are executed as soon as they can, so that
+    // the executer cannot run other commands in between. The last one is
+    // executed by `execute`.
+    for (; m_next + 1 < m_commands.size(); ++m_next) {
+        if (!m_commands[m_next]->canExecuteNow(env)) {
+            return false;
+        }
+        m_commands[m_next]->execute(env);
+        m_commands[m_next].reset();
+    }
+
+    return m_commands.empty() || m_commands.back()->canExecuteNow(env);
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,36 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+
+#include <memory>
+#include <vector>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Executes several commands back to back, as a single command
+ *
+ * No command of another lane runs between the commands of a group. Only
+ * while one of them waits for a condition, the group waits as well.
+ */
+class CommandGroup : public Command {
+public:
+    explicit CommandGroup(std::vector<std::unique_ptr<Command>> commands);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    std::vector<std::unique_ptr<Command>> m_commands;
+    size_t m_next = 0;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,67 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "CompareScreenshot.h"
+
+#include <Spix/CommandExecuter/ImageCache.h>
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+#include <Utils/ImageCompare.h>
+
+namespace spix {
+namespace cmd {
+
+CompareScreenshot::CompareScreenshot(ItemPath targetItemPath, std::string goldenFilePath, int tolerance,
+    bool createDiffImage, std::promise<ImageComparison> promise)
+: m_itemPath {std::move(targetItemPath)}
+, m_goldenFilePath {std::move(goldenFilePath)}
+, m_tolerance {tolerance}
+, m_createDiffImage {createDiffImage}
+, m_promise {std::make_shared<std::promise<ImageComparison>>(std::move(promise))}
+{
+}
+
+void CompareScreenshot::execute(CommandEnvironment& env)
+{
+    std::shared_ptr<Image> image = env.scene().grabImage(m_itemPath);
+    if (!image) {
+        env.state().reportError("CompareScreenshot: Item not found: " + m_itemPath.string());
+        m_promise->set_value({});
+        return;
+    }
+
+    // a golden image that is not cached yet is read and decoded on the worker
+    auto& workers = env.workers();
+    auto& imageCache = env.imageCache();
+    auto& scene = env.scene();
+    workers.post([&workers, &imageCache, &scene, image, goldenFilePath = m_goldenFilePath, tolerance = m_tolerance,
+                     createDiffImage = m_createDiffImage, promise = m_promise]() {
+        auto golden = imageCache.find(goldenFilePath);
+        if (!golden) {
+            auto goldenImage = scene.loadImage(goldenFilePath);
+            if (!goldenImage) {
+                workers.reportError("CompareScreenshot: Cannot load golden image: " + goldenFilePath);
+                promise->set_value({});
+                return;
+            }
+            golden = std::make_shared<RgbaImage>(
+                RgbaImage {goldenImage->width(), goldenImage->height(), goldenImage->rgbaPixels()});
+            imageCache.insert(goldenFilePath, golden);
+        }
+
+        RgbaImage actual {image->width(), image->height(), image->rgbaPixels()};
+        promise->set_value(utils::CompareImages(actual, *golden, tolerance, createDiffImage));
+    });
+}
+
+bool CompareScreenshot::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
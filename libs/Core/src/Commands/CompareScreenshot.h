@@ -0,0 +1,43 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ImageComparison.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <future>
+#include <memory>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Compares the screenshot of an item with a golden image file
+ *
+ * Only the comparison metrics leave the application, not the screenshot.
+ * The golden image is loaded by the scene once and then kept decoded
+ * in the `ImageCache`. The comparison runs on a worker thread.
+ */
+class CompareScreenshot : public Command {
+public:
+    CompareScreenshot(ItemPath targetItemPath, std::string goldenFilePath, int tolerance, bool createDiffImage,
+        std::promise<ImageComparison> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_itemPath;
+    std::string m_goldenFilePath;
+    int m_tolerance;
+    bool m_createDiffImage;
+    std::shared_ptr<std::promise<ImageComparison>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
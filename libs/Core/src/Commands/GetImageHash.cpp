@@ -0,0 +1,63 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "GetImageHash.h"
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+#include <Utils/PerceptualHash.h>
+#include <Utils/XxHash.h>
+
+namespace spix {
+namespace cmd {
+
+namespace {
+
+uint64_t HashImage(const Image& image, ImageHashAlgorithm algorithm)
+{
+    auto pixels = image.rgbaPixels();
+    switch (algorithm) {
+    case ImageHashAlgorithm::XxHash:
+        return utils::XxHash64(pixels);
+    case ImageHashAlgorithm::DHash:
+        return utils::DifferenceHash(pixels, image.width(), image.height());
+    case ImageHashAlgorithm::PHash:
+        return utils::PerceptualHash(pixels, image.width(), image.height());
+    }
+    return 0;
+}
+
+} // namespace
+
+GetImageHash::GetImageHash(ItemPath targetItemPath, ImageHashAlgorithm algorithm, std::promise<uint64_t> promise)
+: m_itemPath {std::move(targetItemPath)}
+, m_algorithm {algorithm}
+, m_promise {std::make_shared<std::promise<uint64_t>>(std::move(promise))}
+{
+}
+
+void GetImageHash::execute(CommandEnvironment& env)
+{
+    std::shared_ptr<Image> image = env.scene().grabImage(m_itemPath);
+    if (!image) {
+        env.state().reportError("GetImageHash: Item not found: " + m_itemPath.string());
+        m_promise->set_value(0);
+        return;
+    }
+
+    env.workers().post([image, algorithm = m_algorithm, promise = m_promise]() {
+        promise->set_value(HashImage(*image, algorithm));
+    });
+}
+
+bool GetImageHash::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,39 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ImageHashAlgorithm.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <cstdint>
+#include <future>
+#include <memory>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Hashes the content of an item, instead of returning its screenshot
+ *
+ * The item is captured on the main thread and hashed by a worker.
+ */
+class GetImageHash : public Command {
+public:
+    GetImageHash(ItemPath targetItemPath, ImageHashAlgorithm algorithm, std::promise<uint64_t> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_itemPath;
+    ImageHashAlgorithm m_algorithm;
+    std::shared_ptr<std::promise<uint64_t>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
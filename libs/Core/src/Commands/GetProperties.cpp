@@ -0,0 +1,46 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "GetProperties.h"
+
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+GetProperties::GetProperties(
+    std::vector<ItemPath> paths, std::vector<std::string> propertyNames, std::promise<PropertyValues> promise)
+: m_paths(std::move(paths))
+, m_propertyNames(std::move(propertyNames))
+, m_promise(std::move(promise))
+{
+}
+
+void GetProperties::execute(CommandEnvironment& env)
+{
+    PropertyValues values;
+    values.reserve(m_paths.size());
+
+    for (const auto& path : m_paths) {
+        Variant::MapType itemValues;
+        auto item = env.scene().itemAtPath(path);
+
+        if (item) {
+            for (const auto& propertyName : m_propertyNames) {
+                itemValues[propertyName] = item->property(propertyName);
+            }
+        } else {
+            env.state().reportError("GetProperties: Item not found: " + path.string());
+        }
+
+        values.push_back(std::move(itemValues));
+    }
+
+    m_promise.set_value(std::move(values));
+}
+
+} // namespace cmd
+} // namespace spix
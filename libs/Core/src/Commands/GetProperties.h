@@ -0,0 +1,43 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/Variant.h>
+
+#include <future>
+#include <vector>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Reads the same properties of several items at once
+ *
+ * The result holds one map of property names to values for each path, in
+ * the order of the paths. The map is empty if the item was not found.
+ */
+class SPIXCORE_EXPORT GetProperties : public Command {
+public:
+    using PropertyValues = std::vector<Variant::MapType>;
+
+    GetProperties(
+        std::vector<ItemPath> paths, std::vector<std::string> propertyNames, std::promise<PropertyValues> promise);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    std::vector<ItemPath> m_paths;
+    std::vector<std::string> m_propertyNames;
+    std::promise<PropertyValues> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
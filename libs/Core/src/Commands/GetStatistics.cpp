@@ -0,0 +1,25 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "GetStatistics.h"
+
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+GetStatistics::GetStatistics(std::promise<Variant::MapType> promise)
+: m_promise(std::move(promise))
+{
+}
+
+void GetStatistics::execute(CommandEnvironment& env)
+{
+    m_promise.set_value(env.scene().statistics());
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,28 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/Variant.h>
+
+#include <future>
+
+namespace spix {
+namespace cmd {
+
+class GetStatistics : public Command {
+public:
+    GetStatistics(std::promise<Variant::MapType> promise);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    std::promise<Variant::MapType> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
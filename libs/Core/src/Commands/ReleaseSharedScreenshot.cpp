@@ -0,0 +1,27 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ReleaseSharedScreenshot.h"
+
+#include <Spix/CommandExecuter/SharedImageStore.h>
+
+namespace spix {
+namespace cmd {
+
+ReleaseSharedScreenshot::ReleaseSharedScreenshot(std::string name)
+: m_name(std::move(name))
+{
+}
+
+void ReleaseSharedScreenshot::execute(CommandEnvironment& env)
+{
+    if (!env.sharedImages().release(m_name)) {
+        env.state().reportError("ReleaseSharedScreenshot: No shared screenshot named " + m_name);
+    }
+}
+
+} // namespace cmd
+} // namespace spix
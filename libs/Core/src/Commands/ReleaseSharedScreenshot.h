@@ -0,0 +1,27 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+
+#include <string>
+
+namespace spix {
+namespace cmd {
+
+class ReleaseSharedScreenshot : public Command {
+public:
+    ReleaseSharedScreenshot(std::string name);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    std::string m_name;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -6,20 +6,48 @@
 
 #include "Screenshot.h"
 
+#include <Spix/CommandExecuter/WorkerPool.h>
 #include <Spix/Scene/Scene.h>
 
 namespace spix {
 namespace cmd {
 
 Screenshot::Screenshot(ItemPath targetItemPath, std::string filePath)
+: Screenshot(std::move(targetItemPath), std::move(filePath), std::promise<bool>())
+{
+}
+
+Screenshot::Screenshot(ItemPath targetItemPath, std::string filePath, std::promise<bool> promise)
 : m_itemPath {std::move(targetItemPath)}
 , m_filePath {std::move(filePath)}
+, m_promise {std::make_shared<std::promise<bool>>(std::move(promise))}
 {
 }
 
 void Screenshot::execute(CommandEnvironment& env)
 {
-    env.scene().takeScreenshot(m_itemPath, m_filePath);
+    std::shared_ptr<Image> image = env.scene().grabImage(m_itemPath);
+    if (!image) {
+        // scenes without `grabImage` (or a missing item) keep the
+        // old behavior and report their own errors
+        env.scene().takeScreenshot(m_itemPath, m_filePath);
+        m_promise->set_value(false);
+        return;
+    }
+
+    auto& workers = env.workers();
+    workers.post([&workers, image, filePath = m_filePath, promise = m_promise]() {
+        bool saved = image->save(filePath);
+        if (!saved) {
+            workers.reportError("Screenshot: Could not write file: " + filePath);
+        }
+        promise->set_value(saved);
+    });
+}
+
+bool Screenshot::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
 }
 
 } // namespace cmd
@@ -9,18 +9,30 @@
 #include <Spix/Commands/Command.h>
 #include <Spix/Data/ItemPath.h>
 
+#include <future>
+#include <memory>
+
 namespace spix {
 namespace cmd {
 
+/**
+ * @brief Save a screenshot of an item to a file
+ *
+ * The item is captured on the main thread, the file is written
+ * by a worker. The promise is fulfilled once the file is written.
+ */
 class Screenshot : public Command {
 public:
     Screenshot(ItemPath targetItemPath, std::string filePath);
+    Screenshot(ItemPath targetItemPath, std::string filePath, std::promise<bool> promise);
 
     void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
 
 private:
     ItemPath m_itemPath;
     std::string m_filePath;
+    std::shared_ptr<std::promise<bool>> m_promise;
 };
 
 } // namespace cmd
@@ -6,20 +6,41 @@
 
 #include "ScreenshotBase64.h"
 
+#include <Spix/CommandExecuter/WorkerPool.h>
 #include <Spix/Scene/Scene.h>
+
+#include <Utils/Base64.h>
+
 namespace spix {
 namespace cmd {
 
 ScreenshotAsBase64::ScreenshotAsBase64(ItemPath targetItemPath, std::promise<std::string> promise)
 : m_itemPath {std::move(targetItemPath)}
-, m_promise(std::move(promise))
+, m_promise {std::make_shared<std::promise<std::string>>(std::move(promise))}
 {
 }
 
 void ScreenshotAsBase64::execute(CommandEnvironment& env)
 {
-    auto value = env.scene().takeScreenshotAsBase64(m_itemPath);
-    m_promise.set_value(value);
+    std::shared_ptr<Image> image = env.scene().grabImage(m_itemPath);
+    if (!image) {
+        m_promise->set_value(env.scene().takeScreenshotAsBase64(m_itemPath));
+        return;
+    }
+
+    auto& workers = env.workers();
+    workers.post([&workers, image, promise = m_promise]() {
+        std::string png;
+        if (!image->encode(ImageEncoding(ImageEncoding::Format::Png), png)) {
+            workers.reportError("ScreenshotAsBase64: Could not encode image");
+        }
+        promise->set_value(utils::EncodeBase64(png));
+    });
+}
+
+bool ScreenshotAsBase64::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
 }
 
 } // namespace cmd
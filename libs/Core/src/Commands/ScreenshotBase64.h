@@ -4,6 +4,7 @@
 #include <Spix/Data/ItemPath.h>
 
 #include <future>
+#include <memory>
 
 namespace spix {
 namespace cmd {
@@ -13,10 +14,11 @@ public:
     ScreenshotAsBase64(ItemPath targetItemPath, std::promise<std::string> promise);
 
     void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
 
 private:
     ItemPath m_itemPath;
-    std::promise<std::string> m_promise;
+    std::shared_ptr<std::promise<std::string>> m_promise;
 };
 
 } // namespace cmd
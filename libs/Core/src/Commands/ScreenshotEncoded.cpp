@@ -0,0 +1,72 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ScreenshotEncoded.h"
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+ScreenshotEncoded::ScreenshotEncoded(ItemPath targetItemPath, ImageEncoding encoding, CaptureMode captureMode,
+    CaptureOptions options, std::promise<EncodedImage> promise)
+: m_itemPath {std::move(targetItemPath)}
+, m_encoding {encoding}
+, m_captureMode {captureMode}
+, m_options {options}
+, m_promise {std::make_shared<std::promise<EncodedImage>>(std::move(promise))}
+{
+}
+
+void ScreenshotEncoded::execute(CommandEnvironment& env)
+{
+    // a region in item coordinates needs the item size to find its pixels
+    Size itemSize;
+    if (m_options.region.size.width > 0 && m_options.region.size.height > 0) {
+        if (auto item = env.scene().itemAtPath(m_itemPath)) {
+            itemSize = item->size();
+        }
+    }
+
+    // the handler may be called after this command is gone, so it must not capture `this` or `env`.
+    // Until then, the job it posts already counts against the worker limit.
+    auto& workers = env.workers();
+    workers.reserve();
+    env.scene().grabImageAsync(m_itemPath, m_captureMode,
+        [&workers, path = m_itemPath, encoding = m_encoding, options = m_options, itemSize, promise = m_promise](
+            std::unique_ptr<Image> grabbed) {
+            std::shared_ptr<Image> image = std::move(grabbed);
+            if (!image) {
+                workers.cancelReservation();
+                workers.reportError("ScreenshotEncoded: Item not found: " + path.string());
+                EncodedImage result;
+                result.encoding = encoding;
+                promise->set_value(std::move(result));
+                return;
+            }
+
+            workers.postReserved([&workers, image, encoding, options, itemSize, promise]() {
+                EncodedImage result;
+                result.encoding = encoding;
+                auto captured = applyCaptureOptions(image, options, itemSize);
+                if (!captured) {
+                    workers.reportError("ScreenshotEncoded: Region is outside of the item");
+                } else if (!encodeImage(*captured, encoding, result)) {
+                    workers.reportError("ScreenshotEncoded: Encoding not supported: " + encoding.toString());
+                }
+                promise->set_value(std::move(result));
+            });
+        });
+}
+
+bool ScreenshotEncoded::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,38 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/CaptureMode.h>
+#include <Spix/Data/CaptureOptions.h>
+#include <Spix/Data/ImageEncoding.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <future>
+#include <memory>
+
+namespace spix {
+namespace cmd {
+
+class ScreenshotEncoded : public Command {
+public:
+    ScreenshotEncoded(ItemPath targetItemPath, ImageEncoding encoding, CaptureMode captureMode,
+        CaptureOptions options, std::promise<EncodedImage> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_itemPath;
+    ImageEncoding m_encoding;
+    CaptureMode m_captureMode;
+    CaptureOptions m_options;
+    std::shared_ptr<std::promise<EncodedImage>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,48 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ScreenshotShared.h"
+
+#include <Spix/CommandExecuter/SharedImageStore.h>
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+ScreenshotShared::ScreenshotShared(ItemPath targetItemPath, std::promise<SharedImage> promise)
+: m_itemPath {std::move(targetItemPath)}
+, m_promise {std::make_shared<std::promise<SharedImage>>(std::move(promise))}
+{
+}
+
+void ScreenshotShared::execute(CommandEnvironment& env)
+{
+    std::shared_ptr<Image> image = env.scene().grabImage(m_itemPath);
+    if (!image) {
+        env.state().reportError("ScreenshotShared: Item not found: " + m_itemPath.string());
+        m_promise->set_value(SharedImage());
+        return;
+    }
+
+    auto& workers = env.workers();
+    auto& sharedImages = env.sharedImages();
+    workers.post([&workers, &sharedImages, image, promise = m_promise]() {
+        auto result = sharedImages.publish(*image);
+        if (result.name.empty()) {
+            workers.reportError("ScreenshotShared: Could not create shared memory");
+        }
+        promise->set_value(std::move(result));
+    });
+}
+
+bool ScreenshotShared::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
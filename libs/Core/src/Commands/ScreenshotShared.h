@@ -0,0 +1,38 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/SharedImage.h>
+
+#include <future>
+#include <memory>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Writes the raw pixels of a screenshot to shared memory
+ *
+ * Lets a client on the same machine read the image without encoding it
+ * or sending it through the RPC connection.
+ */
+class ScreenshotShared : public Command {
+public:
+    ScreenshotShared(ItemPath targetItemPath, std::promise<SharedImage> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_itemPath;
+    std::shared_ptr<std::promise<SharedImage>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
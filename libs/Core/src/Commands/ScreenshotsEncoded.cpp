@@ -0,0 +1,71 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ScreenshotsEncoded.h"
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+ScreenshotsEncoded::ScreenshotsEncoded(std::vector<ItemPath> targetItemPaths, ImageEncoding encoding,
+    CaptureOptions options, std::promise<EncodedImages> promise)
+: m_itemPaths {std::move(targetItemPaths)}
+, m_encoding {encoding}
+, m_options {options}
+, m_promise {std::make_shared<std::promise<EncodedImages>>(std::move(promise))}
+{
+}
+
+void ScreenshotsEncoded::execute(CommandEnvironment& env)
+{
+    auto grabbedImages = env.scene().grabImages(m_itemPaths);
+
+    // a region in item coordinates needs the item sizes to find its pixels
+    bool hasRegion = m_options.region.size.width > 0 && m_options.region.size.height > 0;
+
+    auto images = std::make_shared<std::vector<std::shared_ptr<Image>>>();
+    auto itemSizes = std::make_shared<std::vector<Size>>(m_itemPaths.size());
+    for (size_t i = 0; i < m_itemPaths.size(); ++i) {
+        images->push_back(i < grabbedImages.size() ? std::move(grabbedImages[i]) : nullptr);
+        if (!images->back()) {
+            env.state().reportError("ScreenshotsEncoded: Item not found: " + m_itemPaths[i].string());
+        } else if (hasRegion) {
+            if (auto item = env.scene().itemAtPath(m_itemPaths[i])) {
+                (*itemSizes)[i] = item->size();
+            }
+        }
+    }
+
+    auto& workers = env.workers();
+    workers.post([&workers, images, itemSizes, encoding = m_encoding, options = m_options, promise = m_promise]() {
+        EncodedImages results(images->size());
+        bool reportedError = false;
+        for (size_t i = 0; i < images->size(); ++i) {
+            results[i].encoding = encoding;
+            if (!(*images)[i]) {
+                continue;
+            }
+            auto image = applyCaptureOptions((*images)[i], options, (*itemSizes)[i]);
+            if (!image) {
+                workers.reportError("ScreenshotsEncoded: Region is outside of the item");
+            } else if (!encodeImage(*image, encoding, results[i]) && !reportedError) {
+                workers.reportError("ScreenshotsEncoded: Encoding not supported: " + encoding.toString());
+                reportedError = true;
+            }
+        }
+        promise->set_value(std::move(results));
+    });
+}
+
+bool ScreenshotsEncoded::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,47 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/CaptureOptions.h>
+#include <Spix/Data/ImageEncoding.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Takes screenshots of several items at once
+ *
+ * The scene captures all items in one go, so that each window is only
+ * grabbed once. The result holds one image for each path, in the order
+ * of the paths. The image is empty if the item was not found. The
+ * options apply to each item.
+ */
+class ScreenshotsEncoded : public Command {
+public:
+    using EncodedImages = std::vector<EncodedImage>;
+
+    ScreenshotsEncoded(std::vector<ItemPath> targetItemPaths, ImageEncoding encoding, CaptureOptions options,
+        std::promise<EncodedImages> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    std::vector<ItemPath> m_itemPaths;
+    ImageEncoding m_encoding;
+    CaptureOptions m_options;
+    std::shared_ptr<std::promise<EncodedImages>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,33 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "StartRecording.h"
+
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+StartRecording::StartRecording(ItemPath windowPath, int fps, std::string filePath, std::promise<bool> promise)
+: m_windowPath {std::move(windowPath)}
+, m_fps {fps}
+, m_filePath {std::move(filePath)}
+, m_promise(std::move(promise))
+{
+}
+
+void StartRecording::execute(CommandEnvironment& env)
+{
+    bool started = m_fps > 0 && env.scene().startRecording(m_windowPath, m_fps, m_filePath);
+    if (!started) {
+        env.state().reportError("StartRecording: Cannot record " + m_windowPath.string() + " to " + m_filePath);
+    }
+
+    m_promise.set_value(started);
+}
+
+} // namespace cmd
+} // namespace spix
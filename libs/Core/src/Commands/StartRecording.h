@@ -0,0 +1,31 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <future>
+
+namespace spix {
+namespace cmd {
+
+class StartRecording : public Command {
+public:
+    StartRecording(ItemPath windowPath, int fps, std::string filePath, std::promise<bool> promise);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_windowPath;
+    int m_fps;
+    std::string m_filePath;
+    std::promise<bool> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,38 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "StopRecording.h"
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+#include <Spix/Scene/Scene.h>
+
+namespace spix {
+namespace cmd {
+
+StopRecording::StopRecording(std::promise<RecordingStatistics> promise)
+: m_promise {std::make_shared<std::promise<RecordingStatistics>>(std::move(promise))}
+{
+}
+
+void StopRecording::execute(CommandEnvironment& env)
+{
+    std::shared_ptr<FrameRecorder> recorder = env.scene().stopRecording();
+    if (!recorder) {
+        env.state().reportError("StopRecording: No recording running");
+        m_promise->set_value({});
+        return;
+    }
+
+    env.workers().post([recorder, promise = m_promise]() { promise->set_value(recorder->finish()); });
+}
+
+bool StopRecording::canExecuteNow(CommandEnvironment& env)
+{
+    return env.workers().hasCapacity();
+}
+
+} // namespace cmd
+} // namespace spix
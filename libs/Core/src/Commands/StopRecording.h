@@ -0,0 +1,36 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Scene/FrameRecorder.h>
+
+#include <future>
+#include <memory>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Stops the recording and waits for the buffered frames to be written
+ *
+ * The main thread only stops capturing. The remaining frames are
+ * written on a worker thread.
+ */
+class StopRecording : public Command {
+public:
+    StopRecording(std::promise<RecordingStatistics> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    std::shared_ptr<std::promise<RecordingStatistics>> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,29 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "Subscribe.h"
+
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+
+namespace spix {
+namespace cmd {
+
+Subscribe::Subscribe(ItemPath path, std::vector<std::string> propertyNames, std::chrono::milliseconds minInterval,
+    std::promise<int> promise)
+: m_path(std::move(path))
+, m_propertyNames(std::move(propertyNames))
+, m_minInterval(minInterval)
+, m_promise(std::move(promise))
+{
+}
+
+void Subscribe::execute(CommandEnvironment& env)
+{
+    m_promise.set_value(env.subscriptions().add(std::move(m_path), std::move(m_propertyNames), m_minInterval));
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,40 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Subscribes to changes of properties of an item
+ *
+ * The changes are fetched with `WaitForChanges`.
+ */
+class Subscribe : public Command {
+public:
+    Subscribe(ItemPath path, std::vector<std::string> propertyNames, std::chrono::milliseconds minInterval,
+        std::promise<int> promise);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    ItemPath m_path;
+    std::vector<std::string> m_propertyNames;
+    std::chrono::milliseconds m_minInterval;
+    std::promise<int> m_promise;
+};
+
+} // namespace cmd
+} // namespace spix
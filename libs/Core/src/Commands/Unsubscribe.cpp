@@ -0,0 +1,29 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "Unsubscribe.h"
+
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+
+#include <string>
+
+namespace spix {
+namespace cmd {
+
+Unsubscribe::Unsubscribe(int subscriptionId)
+: m_subscriptionId(subscriptionId)
+{
+}
+
+void Unsubscribe::execute(CommandEnvironment& env)
+{
+    if (!env.subscriptions().remove(m_subscriptionId)) {
+        env.state().reportError("Unsubscribe: No subscription with id " + std::to_string(m_subscriptionId));
+    }
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,25 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+
+namespace spix {
+namespace cmd {
+
+class Unsubscribe : public Command {
+public:
+    Unsubscribe(int subscriptionId);
+
+    void execute(CommandEnvironment& env) override;
+
+private:
+    int m_subscriptionId;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -18,16 +18,19 @@ void Wait::execute(CommandEnvironment&)
 {
 }
 
-bool Wait::canExecuteNow(CommandEnvironment&)
+bool Wait::canExecuteNow(CommandEnvironment& env)
 {
+    auto now = std::chrono::steady_clock::now();
     if (!m_timerInitialized) {
         m_timerInitialized = true;
-        m_startTime = std::chrono::steady_clock::now();
-        return false;
+        m_deadline = now + m_waitTime;
     }
 
-    auto timeSinceStart = std::chrono::steady_clock::now() - m_startTime;
-    return timeSinceStart >= m_waitTime;
+    if (now >= m_deadline) {
+        return true;
+    }
+    env.wakeUpAt(m_deadline);
+    return false;
 }
 
 } // namespace cmd
@@ -22,7 +22,7 @@ public:
 
 private:
     bool m_timerInitialized = false;
-    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_deadline;
     std::chrono::milliseconds m_waitTime;
 };
 
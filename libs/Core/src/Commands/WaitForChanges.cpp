@@ -0,0 +1,105 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "WaitForChanges.h"
+
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+#include <Spix/Scene/Scene.h>
+#include <Utils/VariantCompare.h>
+
+#include <algorithm>
+#include <string>
+
+namespace spix {
+namespace cmd {
+
+WaitForChanges::WaitForChanges(
+    int subscriptionId, std::chrono::milliseconds maxWaitTime, std::promise<Variant::MapType> promise)
+: m_maxWaitTime(maxWaitTime)
+, m_subscriptionId(subscriptionId)
+, m_promise(std::move(promise))
+{
+}
+
+void WaitForChanges::execute(CommandEnvironment& env)
+{
+    if (!env.subscriptions().find(m_subscriptionId)) {
+        env.state().reportError("WaitForChanges: No subscription with id " + std::to_string(m_subscriptionId));
+    }
+    m_promise.set_value(std::move(m_changes));
+}
+
+bool WaitForChanges::canExecuteNow(CommandEnvironment& env)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!m_timerInitialized) {
+        m_timerInitialized = true;
+        m_startTime = now;
+    }
+    auto deadline = m_startTime + m_maxWaitTime;
+
+    auto subscription = env.subscriptions().find(m_subscriptionId);
+    if (!subscription) {
+        return true;
+    }
+
+    // Rate limit: changes until the next delivery are coalesced
+    if (subscription->sent && now < subscription->lastSent + subscription->minInterval) {
+        if (now >= deadline) {
+            return true;
+        }
+        env.wakeUpAt(std::min(deadline, subscription->lastSent + subscription->minInterval));
+        return false;
+    }
+
+    // the path is resolved once for all properties, and the item only if one of them changed
+    auto allChanges = env.scene().propertyChanges(subscription->path, subscription->properties);
+    bool needsPolling = false;
+    bool itemResolved = false;
+    std::unique_ptr<Item> item;
+    for (size_t i = 0; i < subscription->properties.size(); ++i) {
+        const auto& property = subscription->properties[i];
+        auto changes = allChanges[i];
+        needsPolling = needsPolling || changes < 0;
+
+        auto lastChanges = subscription->propertyChanges.find(property);
+        if (changes >= 0 && lastChanges != subscription->propertyChanges.end() && lastChanges->second == changes) {
+            continue;
+        }
+        subscription->propertyChanges[property] = changes;
+
+        if (!itemResolved) {
+            itemResolved = true;
+            item = env.scene().itemAtPath(subscription->path);
+        }
+        auto value = item ? item->property(property) : Variant(nullptr);
+        auto sentValue = subscription->sentValues.find(property);
+        if (!subscription->sent || sentValue == subscription->sentValues.end()
+            || !utils::VariantsEqual(value, sentValue->second)) {
+            m_changes[property] = std::move(value);
+        }
+    }
+
+    if (!m_changes.empty()) {
+        for (const auto& change : m_changes) {
+            subscription->sentValues[change.first] = change.second;
+        }
+        subscription->sent = true;
+        subscription->lastSent = now;
+        return true;
+    }
+
+    if (now >= deadline) {
+        return true;
+    }
+    if (!needsPolling) {
+        env.wakeUpAt(deadline);
+    }
+    return false;
+}
+
+} // namespace cmd
+} // namespace spix
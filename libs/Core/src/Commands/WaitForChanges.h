@@ -0,0 +1,43 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/Variant.h>
+
+#include <chrono>
+#include <future>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Waits until properties of a subscription changed
+ *
+ * Returns the changed properties with their latest values, or an empty
+ * map if nothing changed within `maxWaitTime`. The first call after
+ * subscribing returns all properties. Properties are only read again
+ * after they changed, if the scene tracks changes of the property.
+ */
+class WaitForChanges : public Command {
+public:
+    WaitForChanges(int subscriptionId, std::chrono::milliseconds maxWaitTime, std::promise<Variant::MapType> promise);
+
+    void execute(CommandEnvironment& env) override;
+    bool canExecuteNow(CommandEnvironment& env) override;
+
+private:
+    bool m_timerInitialized = false;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::milliseconds m_maxWaitTime;
+    int m_subscriptionId;
+    std::promise<Variant::MapType> m_promise;
+    Variant::MapType m_changes;
+};
+
+} // namespace cmd
+} // namespace spix
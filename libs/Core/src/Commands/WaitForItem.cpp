@@ -11,9 +11,9 @@ namespace spix {
 namespace cmd {
 
 WaitForItem::WaitForItem(ItemPath path, std::chrono::milliseconds maxWaitTime, std::promise<bool> promise)
-: m_path(std::move(path))
+: m_wait(std::move(maxWaitTime))
+, m_path(std::move(path))
 , m_promise(std::move(promise))
-, m_maxWaitTime(std::move(maxWaitTime))
 {
 }
 
@@ -24,20 +24,14 @@ void WaitForItem::execute(CommandEnvironment& env)
 
 bool WaitForItem::canExecuteNow(CommandEnvironment& env)
 {
-    if (!m_timerInitialized) {
-        m_timerInitialized = true;
-        m_startTime = std::chrono::steady_clock::now();
-        return false;
-    }
-
-    auto item = env.scene().itemAtPath(m_path);
-    if (item) {
+    return m_wait.isOver(env, env.scene().itemTreeChanges(m_path), [this, &env] {
+        auto item = env.scene().itemAtPath(m_path);
+        if (!item) {
+            return false;
+        }
         m_itemFound = item->visible();
         return true;
-    }
-
-    auto timeSinceStart = std::chrono::steady_clock::now() - m_startTime;
-    return timeSinceStart >= m_maxWaitTime;
+    });
 }
 
 } // namespace cmd
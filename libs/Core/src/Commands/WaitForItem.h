@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "ChangeWait.h"
 #include <Spix/Commands/Command.h>
 #include <Spix/Data/ItemPath.h>
 
@@ -15,6 +16,12 @@
 namespace spix {
 namespace cmd {
 
+/**
+ * @brief Waits until the item at a path exists
+ *
+ * The path is only resolved again after the item tree changed, if the
+ * scene tracks changes. Otherwise it is resolved on each check.
+ */
 class WaitForItem : public Command {
 public:
     WaitForItem(ItemPath path, std::chrono::milliseconds maxWaitTime, std::promise<bool> promise);
@@ -23,9 +30,7 @@ public:
     bool canExecuteNow(CommandEnvironment&) override;
 
 private:
-    bool m_timerInitialized = false;
-    std::chrono::steady_clock::time_point m_startTime;
-    std::chrono::milliseconds m_maxWaitTime;
+    ChangeWait m_wait;
     ItemPath m_path;
     std::promise<bool> m_promise;
     bool m_itemFound = false;
@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "WaitForProperty.h"
+
+#include <Spix/Scene/Scene.h>
+#include <Utils/VariantCompare.h>
+
+namespace spix {
+namespace cmd {
+
+WaitForProperty::WaitForProperty(ItemPath path, std::string propertyName, Variant expectedValue,
+    std::chrono::milliseconds maxWaitTime, std::promise<bool> promise)
+: m_wait(std::move(maxWaitTime))
+, m_path(std::move(path))
+, m_propertyName(std::move(propertyName))
+, m_expectedValue(std::move(expectedValue))
+, m_promise(std::move(promise))
+{
+}
+
+void WaitForProperty::execute(CommandEnvironment&)
+{
+    m_promise.set_value(m_matched);
+}
+
+bool WaitForProperty::canExecuteNow(CommandEnvironment& env)
+{
+    return m_wait.isOver(env, env.scene().propertyChanges(m_path, m_propertyName), [this, &env] {
+        m_matched = hasExpectedValue(env);
+        return m_matched;
+    });
+}
+
+bool WaitForProperty::hasExpectedValue(CommandEnvironment& env)
+{
+    auto item = env.scene().itemAtPath(m_path);
+    if (!item) {
+        return false;
+    }
+
+    if (auto expectedString = std::get_if<std::string>(&m_expectedValue.base())) {
+        return item->stringProperty(m_propertyName) == *expectedString;
+    }
+    return utils::VariantsEqual(item->property(m_propertyName), m_expectedValue);
+}
+
+} // namespace cmd
+} // namespace spix
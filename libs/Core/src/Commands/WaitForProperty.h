@@ -0,0 +1,50 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include "ChangeWait.h"
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/Variant.h>
+
+#include <chrono>
+#include <future>
+#include <string>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Waits until a property of an item has the expected value
+ *
+ * The property is only read again after it changed, if the scene tracks
+ * changes of the property. Otherwise it is read on each check.
+ *
+ * A string is compared with the property converted to a string, numbers
+ * are compared by value regardless of their type.
+ */
+class WaitForProperty : public Command {
+public:
+    WaitForProperty(ItemPath path, std::string propertyName, Variant expectedValue,
+        std::chrono::milliseconds maxWaitTime, std::promise<bool> promise);
+
+    void execute(CommandEnvironment&) override;
+    bool canExecuteNow(CommandEnvironment&) override;
+
+private:
+    bool hasExpectedValue(CommandEnvironment& env);
+
+    ChangeWait m_wait;
+    ItemPath m_path;
+    std::string m_propertyName;
+    Variant m_expectedValue;
+    std::promise<bool> m_promise;
+    bool m_matched = false;
+};
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,77 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "WaitForStableFrame.h"
+
+#include <Spix/Scene/Scene.h>
+
+#include <Utils/XxHash.h>
+
+namespace spix {
+namespace cmd {
+
+namespace {
+
+// A window renders again within a few frames after an input event,
+// so no frame for this long means that nothing is going to change.
+constexpr auto idleTime = std::chrono::milliseconds(100);
+
+} // namespace
+
+WaitForStableFrame::WaitForStableFrame(
+    ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime, std::promise<bool> promise)
+: m_maxWaitTime(maxWaitTime)
+, m_path(std::move(path))
+, m_consecutiveFrames(consecutiveFrames)
+, m_promise(std::move(promise))
+{
+}
+
+void WaitForStableFrame::execute(CommandEnvironment&)
+{
+    m_promise.set_value(m_stable);
+}
+
+bool WaitForStableFrame::canExecuteNow(CommandEnvironment& env)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!m_timerInitialized) {
+        m_timerInitialized = true;
+        m_startTime = now;
+    }
+
+    auto frameNumber = env.scene().renderedFrames(m_path);
+    if (frameNumber < 0 || frameNumber != m_lastFrameNumber || m_identicalFrames == 0) {
+        m_lastFrameNumber = frameNumber;
+        m_lastFrameTime = now;
+        sampleFrame(env);
+    } else if (now - m_lastFrameTime >= idleTime) {
+        m_stable = true;
+    }
+
+    m_stable = m_stable || (m_identicalFrames > 0 && m_identicalFrames >= m_consecutiveFrames);
+    return m_stable || now - m_startTime >= m_maxWaitTime;
+}
+
+void WaitForStableFrame::sampleFrame(CommandEnvironment& env)
+{
+    auto image = env.scene().grabImage(m_path);
+    if (!image) {
+        m_identicalFrames = 0;
+        return;
+    }
+
+    auto hash = utils::XxHash64(image->rgbaPixels());
+    if (m_identicalFrames > 0 && hash == m_lastHash) {
+        ++m_identicalFrames;
+    } else {
+        m_lastHash = hash;
+        m_identicalFrames = 1;
+    }
+}
+
+} // namespace cmd
+} // namespace spix
@@ -0,0 +1,53 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Commands/Command.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+
+namespace spix {
+namespace cmd {
+
+/**
+ * @brief Waits until an item looks the same for a number of frames
+ *
+ * The item is hashed whenever its window rendered a new frame. If the
+ * scene cannot count frames, it is hashed on each check instead. A window
+ * that stops rendering cannot change anymore, so it counts as stable
+ * after a short idle time.
+ */
+class WaitForStableFrame : public Command {
+public:
+    WaitForStableFrame(
+        ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime, std::promise<bool> promise);
+
+    void execute(CommandEnvironment&) override;
+    bool canExecuteNow(CommandEnvironment&) override;
+
+private:
+    void sampleFrame(CommandEnvironment& env);
+
+    bool m_timerInitialized = false;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_lastFrameTime;
+    std::chrono::milliseconds m_maxWaitTime;
+    ItemPath m_path;
+    int m_consecutiveFrames;
+    std::promise<bool> m_promise;
+
+    long long m_lastFrameNumber = -1;
+    uint64_t m_lastHash = 0;
+    int m_identicalFrames = 0;
+    bool m_stable = false;
+};
+
+} // namespace cmd
+} // namespace spix
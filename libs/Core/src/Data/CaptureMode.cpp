@@ -0,0 +1,48 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/Data/CaptureMode.h>
+
+#include <stdexcept>
+
+namespace spix {
+
+namespace {
+
+struct ModeInfo {
+    CaptureMode mode;
+    const char* name;
+};
+
+const ModeInfo modes[] = {
+    {CaptureMode::Default, "default"},
+    {CaptureMode::Window, "window"},
+    {CaptureMode::Item, "item"},
+};
+
+} // namespace
+
+CaptureMode captureModeFromString(const std::string& name)
+{
+    for (const auto& info : modes) {
+        if (name == info.name) {
+            return info.mode;
+        }
+    }
+    throw std::invalid_argument("Unknown capture mode: " + name);
+}
+
+std::string captureModeName(CaptureMode mode)
+{
+    for (const auto& info : modes) {
+        if (info.mode == mode) {
+            return info.name;
+        }
+    }
+    throw std::invalid_argument("Unknown capture mode");
+}
+
+} // namespace spix
@@ -0,0 +1,106 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/Data/ImageEncoding.h>
+
+#include <stdexcept>
+
+namespace spix {
+
+namespace {
+
+struct FormatInfo {
+    ImageEncoding::Format format;
+    const char* name;
+    int maxLevel;
+};
+
+const FormatInfo formats[] = {
+    {ImageEncoding::Format::Raw, "raw", ImageEncoding::DefaultLevel},
+    {ImageEncoding::Format::Qoi, "qoi", ImageEncoding::DefaultLevel},
+    {ImageEncoding::Format::Png, "png", 9},
+    {ImageEncoding::Format::Jpeg, "jpeg", 100},
+    {ImageEncoding::Format::WebP, "webp", 100},
+};
+
+const FormatInfo& InfoForFormat(ImageEncoding::Format format)
+{
+    for (const auto& info : formats) {
+        if (info.format == format) {
+            return info;
+        }
+    }
+    throw std::invalid_argument("Unknown image format");
+}
+
+} // namespace
+
+ImageEncoding::ImageEncoding(Format format, int level)
+: m_format(format)
+, m_level(level)
+{
+    if (level != DefaultLevel && (level < 0 || level > InfoForFormat(format).maxLevel)) {
+        throw std::invalid_argument("Invalid level for image format " + formatName());
+    }
+}
+
+ImageEncoding ImageEncoding::fromString(const std::string& encoding)
+{
+    auto separator = encoding.find(':');
+    auto name = encoding.substr(0, separator);
+    if (name == "jpg") {
+        name = "jpeg";
+    }
+
+    for (const auto& info : formats) {
+        if (name != info.name) {
+            continue;
+        }
+        if (separator == std::string::npos) {
+            return ImageEncoding(info.format);
+        }
+
+        auto levelString = encoding.substr(separator + 1);
+        size_t parsedLength = 0;
+        int level = DefaultLevel;
+        try {
+            level = std::stoi(levelString, &parsedLength);
+        } catch (const std::exception&) {
+            parsedLength = 0;
+        }
+        if (parsedLength == 0 || parsedLength != levelString.size()) {
+            throw std::invalid_argument("Invalid level in image encoding: " + encoding);
+        }
+        return ImageEncoding(info.format, level);
+    }
+
+    throw std::invalid_argument("Unknown image encoding: " + encoding);
+}
+
+ImageEncoding::Format ImageEncoding::format() const
+{
+    return m_format;
+}
+
+int ImageEncoding::level() const
+{
+    return m_level;
+}
+
+std::string ImageEncoding::formatName() const
+{
+    return InfoForFormat(m_format).name;
+}
+
+std::string ImageEncoding::toString() const
+{
+    if (m_level == DefaultLevel) {
+        return formatName();
+    }
+    return formatName() + ":" + std::to_string(m_level);
+}
+
+} // namespace spix
@@ -0,0 +1,48 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/Data/ImageHashAlgorithm.h>
+
+#include <stdexcept>
+
+namespace spix {
+
+namespace {
+
+struct AlgorithmInfo {
+    ImageHashAlgorithm algorithm;
+    const char* name;
+};
+
+const AlgorithmInfo algorithms[] = {
+    {ImageHashAlgorithm::XxHash, "xxhash"},
+    {ImageHashAlgorithm::DHash, "dhash"},
+    {ImageHashAlgorithm::PHash, "phash"},
+};
+
+} // namespace
+
+ImageHashAlgorithm imageHashAlgorithmFromString(const std::string& name)
+{
+    for (const auto& info : algorithms) {
+        if (name == info.name) {
+            return info.algorithm;
+        }
+    }
+    throw std::invalid_argument("Unknown image hash algorithm: " + name);
+}
+
+std::string imageHashAlgorithmName(ImageHashAlgorithm algorithm)
+{
+    for (const auto& info : algorithms) {
+        if (info.algorithm == algorithm) {
+            return info.name;
+        }
+    }
+    throw std::invalid_argument("Unknown image hash algorithm");
+}
+
+} // namespace spix
@@ -0,0 +1,176 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/Scene/FrameRecorder.h>
+
+#include <Utils/RleEncoder.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace spix {
+
+namespace {
+
+constexpr char fileMagic[] = "SPIXREC1";
+constexpr unsigned char keyFrame = 0;
+constexpr unsigned char deltaFrame = 1;
+
+// a full frame every few seconds, so that damaged files can be skipped through
+constexpr int keyFrameIntervalSeconds = 2;
+
+void AppendUint(std::string& out, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+    }
+}
+
+} // namespace
+
+FrameRecorder::FrameRecorder(const std::string& filePath, int fps, size_t bufferedFrames)
+: m_fps(std::max(fps, 1))
+, m_startTime(std::chrono::steady_clock::now())
+, m_file(filePath, std::ios::binary | std::ios::trunc)
+, m_ring(std::max<size_t>(bufferedFrames, 1))
+{
+    if (!m_file) {
+        return;
+    }
+
+    std::string header(fileMagic, sizeof(fileMagic) - 1);
+    AppendUint(header, static_cast<uint64_t>(m_fps), 4);
+    m_file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    m_statistics.bytesWritten = static_cast<long long>(header.size());
+
+    m_thread = std::thread([this] { run(); });
+}
+
+FrameRecorder::~FrameRecorder()
+{
+    finish();
+}
+
+bool FrameRecorder::isOpen() const
+{
+    return m_thread.joinable();
+}
+
+int FrameRecorder::fps() const
+{
+    return m_fps;
+}
+
+std::chrono::microseconds FrameRecorder::frameInterval() const
+{
+    return std::chrono::microseconds(1000000 / m_fps);
+}
+
+void FrameRecorder::addFrame(std::unique_ptr<Image> frame, std::chrono::microseconds captureTime)
+{
+    auto timestamp
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_totalCaptureTime += captureTime;
+        m_statistics.maxCaptureTime = std::max(m_statistics.maxCaptureTime, captureTime);
+
+        if (m_finishing || m_ringSize == m_ring.size()) {
+            ++m_statistics.droppedFrames;
+            return;
+        }
+
+        auto& slot = m_ring[(m_ringStart + m_ringSize) % m_ring.size()];
+        slot.image = std::move(frame);
+        slot.timestamp = timestamp;
+        ++m_ringSize;
+    }
+    m_frameAvailable.notify_one();
+}
+
+RecordingStatistics FrameRecorder::finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finishing = true;
+    }
+    m_frameAvailable.notify_one();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+        m_file.close();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto statistics = m_statistics;
+    statistics.duration
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime);
+    auto grabbedFrames = statistics.frames + statistics.droppedFrames;
+    if (grabbedFrames > 0) {
+        statistics.averageCaptureTime = m_totalCaptureTime / grabbedFrames;
+    }
+    if (statistics.frames > 0) {
+        statistics.averageEncodeTime = m_totalEncodeTime / statistics.frames;
+    }
+    return statistics;
+}
+
+void FrameRecorder::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_frameAvailable.wait(lock, [this] { return m_finishing || m_ringSize > 0; });
+        if (m_ringSize == 0) {
+            return;
+        }
+
+        Frame frame = std::move(m_ring[m_ringStart]);
+        m_ringStart = (m_ringStart + 1) % m_ring.size();
+        --m_ringSize;
+
+        lock.unlock();
+        writeFrame(frame);
+        frame.image.reset();
+        lock.lock();
+    }
+}
+
+void FrameRecorder::writeFrame(const Frame& frame)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    const int width = frame.image->width();
+    const int height = frame.image->height();
+    auto pixels = frame.image->rgbaPixels();
+
+    bool isKeyFrame = width != m_previousWidth || height != m_previousHeight
+        || m_framesSinceKeyFrame >= static_cast<long long>(m_fps) * keyFrameIntervalSeconds;
+    auto payload = utils::EncodeRle(pixels, isKeyFrame ? nullptr : &m_previousPixels);
+    m_framesSinceKeyFrame = isKeyFrame ? 1 : m_framesSinceKeyFrame + 1;
+
+    std::string record;
+    AppendUint(record, static_cast<uint64_t>(frame.timestamp.count()), 8);
+    AppendUint(record, static_cast<uint64_t>(width), 4);
+    AppendUint(record, static_cast<uint64_t>(height), 4);
+    record.push_back(static_cast<char>(isKeyFrame ? keyFrame : deltaFrame));
+    AppendUint(record, payload.size(), 4);
+    m_file.write(record.data(), static_cast<std::streamsize>(record.size()));
+    m_file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    m_file.flush();
+
+    m_previousPixels = std::move(pixels);
+    m_previousWidth = width;
+    m_previousHeight = height;
+
+    auto encodeTime
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_statistics.frames;
+    m_statistics.bytesWritten += static_cast<long long>(record.size() + payload.size());
+    m_totalEncodeTime += encodeTime;
+}
+
+} // namespace spix
@@ -0,0 +1,139 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <Spix/Scene/Image.h>
+
+#include <Utils/QoiEncoder.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace spix {
+
+bool encodeImage(const Image& image, const ImageEncoding& encoding, EncodedImage& result)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    result.encoding = encoding;
+    result.width = image.width();
+    result.height = image.height();
+    result.data.clear();
+
+    bool success = true;
+    switch (encoding.format()) {
+    case ImageEncoding::Format::Raw:
+        result.data = image.rgbaPixels();
+        break;
+    case ImageEncoding::Format::Qoi:
+        result.data = utils::EncodeQoi(image.rgbaPixels(), result.width, result.height);
+        break;
+    default:
+        success = image.encode(encoding, result.data);
+        break;
+    }
+
+    result.encodeTime
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    return success;
+}
+
+std::shared_ptr<Image> applyCaptureOptions(
+    std::shared_ptr<Image> image, const CaptureOptions& options, const Size& itemSize)
+{
+    const auto& region = options.region;
+    if (region.size.width > 0 && region.size.height > 0 && itemSize.width > 0 && itemSize.height > 0) {
+        // the image has the item's size times the device pixel ratio
+        auto ratioX = image->width() / itemSize.width;
+        auto ratioY = image->height() / itemSize.height;
+        auto left = std::max(0, static_cast<int>(std::floor(region.topLeft.x * ratioX)));
+        auto top = std::max(0, static_cast<int>(std::floor(region.topLeft.y * ratioY)));
+        auto right
+            = std::min(image->width(), static_cast<int>(std::ceil((region.topLeft.x + region.size.width) * ratioX)));
+        auto bottom
+            = std::min(image->height(), static_cast<int>(std::ceil((region.topLeft.y + region.size.height) * ratioY)));
+        if (left >= right || top >= bottom) {
+            return {};
+        }
+        if (right - left != image->width() || bottom - top != image->height()) {
+            image = image->copy(left, top, right - left, bottom - top);
+        }
+    }
+
+    auto scale = 1.0;
+    if (options.maxWidth > 0) {
+        scale = std::min(scale, static_cast<double>(options.maxWidth) / image->width());
+    }
+    if (options.maxHeight > 0) {
+        scale = std::min(scale, static_cast<double>(options.maxHeight) / image->height());
+    }
+    if (scale < 1.0) {
+        auto width = std::max(1, static_cast<int>(std::lround(image->width() * scale)));
+        auto height = std::max(1, static_cast<int>(std::lround(image->height() * scale)));
+        image = image->scaled(width, height);
+    }
+
+    return image;
+}
+
+CroppedImage::CroppedImage(std::shared_ptr<const Image> source, int x, int y, int width, int height)
+: m_source(std::move(source))
+, m_x(x)
+, m_y(y)
+, m_width(width)
+, m_height(height)
+{
+}
+
+int CroppedImage::width() const
+{
+    return m_width;
+}
+
+int CroppedImage::height() const
+{
+    return m_height;
+}
+
+std::string CroppedImage::rgbaPixels() const
+{
+    return cropped().rgbaPixels();
+}
+
+void CroppedImage::writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const
+{
+    // write straight from the source instead of cropping first
+    m_source->writeRgbaPixels(m_x + x, m_y + y, width, height, pixels, stride);
+}
+
+bool CroppedImage::encode(const ImageEncoding& encoding, std::string& data) const
+{
+    return cropped().encode(encoding, data);
+}
+
+bool CroppedImage::save(const std::string& filePath) const
+{
+    return cropped().save(filePath);
+}
+
+std::unique_ptr<Image> CroppedImage::copy(int x, int y, int width, int height) const
+{
+    // copy straight from the source instead of cropping twice
+    return m_source->copy(m_x + x, m_y + y, width, height);
+}
+
+std::unique_ptr<Image> CroppedImage::scaled(int width, int height) const
+{
+    return cropped().scaled(width, height);
+}
+
+const Image& CroppedImage::cropped() const
+{
+    std::call_once(m_cropOnce, [this] { m_cropped = m_source->copy(m_x, m_y, m_width, m_height); });
+    return *m_cropped;
+}
+
+} // namespace spix
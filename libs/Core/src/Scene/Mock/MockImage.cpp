@@ -0,0 +1,77 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "MockImage.h"
+
+#include <cstring>
+
+namespace spix {
+
+MockImage::MockImage(int width, int height, uint32_t rgba)
+: m_width(width)
+, m_height(height)
+, m_rgba(rgba)
+{
+}
+
+int MockImage::width() const
+{
+    return m_width;
+}
+
+int MockImage::height() const
+{
+    return m_height;
+}
+
+std::string MockImage::rgbaPixels() const
+{
+    const char pixel[] = {static_cast<char>(m_rgba >> 24), static_cast<char>(m_rgba >> 16),
+        static_cast<char>(m_rgba >> 8), static_cast<char>(m_rgba)};
+
+    std::string pixels;
+    pixels.reserve(static_cast<size_t>(m_width) * m_height * 4);
+    for (int i = 0; i < m_width * m_height; ++i) {
+        pixels.append(pixel, 4);
+    }
+    return pixels;
+}
+
+void MockImage::writeRgbaPixels(int, int, int width, int height, char* pixels, size_t stride) const
+{
+    const char pixel[] = {static_cast<char>(m_rgba >> 24), static_cast<char>(m_rgba >> 16),
+        static_cast<char>(m_rgba >> 8), static_cast<char>(m_rgba)};
+
+    for (int y = 0; y < height; ++y) {
+        auto row = pixels + y * stride;
+        for (int x = 0; x < width; ++x) {
+            std::memcpy(row + x * 4, pixel, 4);
+        }
+    }
+}
+
+bool MockImage::encode(const ImageEncoding& encoding, std::string& data) const
+{
+    data = encoding.formatName() + " image";
+    return true;
+}
+
+bool MockImage::save(const std::string&) const
+{
+    return true;
+}
+
+std::unique_ptr<Image> MockImage::copy(int, int, int width, int height) const
+{
+    return std::make_unique<MockImage>(width, height, m_rgba);
+}
+
+std::unique_ptr<Image> MockImage::scaled(int width, int height) const
+{
+    return std::make_unique<MockImage>(width, height, m_rgba);
+}
+
+} // namespace spix
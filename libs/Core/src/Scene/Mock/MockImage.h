@@ -0,0 +1,43 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/spix_core_export.h>
+
+#include <Spix/Scene/Image.h>
+
+#include <cstdint>
+
+namespace spix {
+
+/**
+ * @brief Image filled with a single color
+ *
+ * Compressed formats are not actually encoded, the encoded data
+ * only names the format.
+ */
+class SPIXCORE_EXPORT MockImage : public Image {
+public:
+    MockImage(int width, int height, uint32_t rgba = 0xffffffff);
+
+    // Image interface
+    int width() const override;
+    int height() const override;
+    std::string rgbaPixels() const override;
+    void writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const override;
+    bool encode(const ImageEncoding& encoding, std::string& data) const override;
+    bool save(const std::string& filePath) const override;
+    std::unique_ptr<Image> copy(int x, int y, int width, int height) const override;
+    std::unique_ptr<Image> scaled(int width, int height) const override;
+
+private:
+    int m_width;
+    int m_height;
+    uint32_t m_rgba;
+};
+
+} // namespace spix
@@ -11,6 +11,7 @@ namespace spix {
 
 std::unique_ptr<Item> MockScene::itemAtPath(const ItemPath& path)
 {
+    ++m_itemLookups;
     auto foundItem = m_items.find(path.string());
     if (foundItem != m_items.end()) {
         return std::make_unique<MockItem>(foundItem->second);
@@ -33,9 +34,75 @@ std::string MockScene::takeScreenshotAsBase64(const ItemPath&)
     return "Base64 String";
 }
 
+std::unique_ptr<Image> MockScene::grabImage(const ItemPath& targetItem)
+{
+    auto foundItem = m_items.find(targetItem.string());
+    if (foundItem == m_items.end()) {
+        return {};
+    }
+
+    auto size = foundItem->second.size();
+    return std::make_unique<MockImage>(static_cast<int>(size.width), static_cast<int>(size.height));
+}
+
+std::unique_ptr<Image> MockScene::loadImage(const std::string& filePath)
+{
+    auto foundImage = m_imageFiles.find(filePath);
+    if (foundImage == m_imageFiles.end()) {
+        return {};
+    }
+
+    return std::make_unique<MockImage>(foundImage->second);
+}
+
+bool MockScene::startRecording(const ItemPath& windowPath, int fps, const std::string& filePath)
+{
+    auto frame = grabImage(windowPath);
+    if (!frame || m_recorder) {
+        return false;
+    }
+
+    auto recorder = std::make_unique<FrameRecorder>(filePath, fps);
+    if (!recorder->isOpen()) {
+        return false;
+    }
+
+    recorder->addFrame(std::move(frame), std::chrono::microseconds(0));
+    m_recorder = std::move(recorder);
+    return true;
+}
+
+std::unique_ptr<FrameRecorder> MockScene::stopRecording()
+{
+    return std::move(m_recorder);
+}
+
+long long MockScene::itemTreeChanges(const ItemPath&)
+{
+    return m_itemTreeChanges;
+}
+
+long long MockScene::propertyChanges(const ItemPath&, const std::string&)
+{
+    return m_propertyChanges;
+}
+
 void MockScene::addItemAtPath(MockItem item, const ItemPath& path)
 {
     m_items.emplace(std::make_pair(path.string(), std::move(item)));
+    ++m_itemTreeChanges;
+    ++m_propertyChanges;
+}
+
+void MockScene::setItemProperty(const ItemPath& path, const std::string& name, const std::string& value)
+{
+    m_items.at(path.string()).stringProperties()[name] = value;
+    ++m_propertyChanges;
+}
+
+void MockScene::addImageFile(MockImage image, const std::string& filePath)
+{
+    m_imageFiles.emplace(filePath, std::move(image));
 }
 
 MockEvents& MockScene::mockEvents()
@@ -43,4 +110,9 @@ MockEvents& MockScene::mockEvents()
     return m_events;
 }
 
+int MockScene::itemLookups() const
+{
+    return m_itemLookups;
+}
+
 } // namespace spix
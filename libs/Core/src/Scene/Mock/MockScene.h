@@ -9,6 +9,7 @@
 #include <Spix/spix_core_export.h>
 
 #include <Scene/Mock/MockEvents.h>
+#include <Scene/Mock/MockImage.h>
 #include <Scene/Mock/MockItem.h>
 #include <Spix/Scene/Scene.h>
 #include <map>
@@ -26,13 +27,35 @@ public:
     // Tasks
     void takeScreenshot(const ItemPath& targetItem, const std::string& filePath) override;
     std::string takeScreenshotAsBase64(const ItemPath& targetItem) override;
+    std::unique_ptr<Image> grabImage(const ItemPath& targetItem) override;
+    std::unique_ptr<Image> loadImage(const std::string& filePath) override;
+
+    /// Records a single frame of the item at `windowPath`
+    bool startRecording(const ItemPath& windowPath, int fps, const std::string& filePath) override;
+    std::unique_ptr<FrameRecorder> stopRecording() override;
+
+    /// Counts calls to `addItemAtPath`
+    long long itemTreeChanges(const ItemPath& path) override;
+
+    /// Counts calls to `addItemAtPath` and `setItemProperty`
+    using Scene::propertyChanges;
+    long long propertyChanges(const ItemPath& path, const std::string& propertyName) override;
+
     // Mock stuff
     void addItemAtPath(MockItem item, const ItemPath& path);
+    void setItemProperty(const ItemPath& path, const std::string& name, const std::string& value);
+    void addImageFile(MockImage image, const std::string& filePath);
     MockEvents& mockEvents();
+    int itemLookups() const;
 
 private:
     std::map<std::string, MockItem> m_items;
+    std::map<std::string, MockImage> m_imageFiles;
     MockEvents m_events;
+    std::unique_ptr<FrameRecorder> m_recorder;
+    long long m_itemTreeChanges = 0;
+    long long m_propertyChanges = 0;
+    int m_itemLookups = 0;
 };
 
 } // namespace spix
@@ -9,6 +9,7 @@
 #include <Spix/CommandExecuter/CommandExecuter.h>
 
 #include <Commands/ClickOnItem.h>
+#include <Commands/CompareScreenshot.h>
 #include <Commands/CustomCmd.h>
 #include <Commands/DragBegin.h>
 #include <Commands/DragEnd.h>
@@ -16,16 +17,30 @@
 #include <Commands/EnterKey.h>
 #include <Commands/ExistsAndVisible.h>
 #include <Commands/GetBoundingBox.h>
+#include <Commands/GetImageHash.h>
+#include <Commands/GetProperties.h>
 #include <Commands/GetProperty.h>
+#include <Commands/GetStatistics.h>
 #include <Commands/GetTestStatus.h>
 #include <Commands/InputText.h>
 #include <Commands/InvokeMethod.h>
 #include <Commands/Quit.h>
+#include <Commands/ReleaseSharedScreenshot.h>
 #include <Commands/Screenshot.h>
 #include <Commands/ScreenshotBase64.h>
+#include <Commands/ScreenshotEncoded.h>
+#include <Commands/ScreenshotShared.h>
+#include <Commands/ScreenshotsEncoded.h>
 #include <Commands/SetProperty.h>
+#include <Commands/StartRecording.h>
+#include <Commands/StopRecording.h>
+#include <Commands/Subscribe.h>
+#include <Commands/Unsubscribe.h>
 #include <Commands/Wait.h>
+#include <Commands/WaitForChanges.h>
 #include <Commands/WaitForItem.h>
+#include <Commands/WaitForProperty.h>
+#include <Commands/WaitForStableFrame.h>
 
 #include <Spix/Events/Identifiers.h>
 
@@ -57,6 +72,11 @@ void TestServer::setGenericCommandHandler(std::function<void(std::string, std::s
     m_handler = handler;
 }
 
+void TestServer::runCommandGroup(const std::function<void()>& commands)
+{
+    m_cmdExec->enqueueCommandGroup(commands);
+}
+
 // ####################
 // # Commands
 // ####################
@@ -121,12 +141,7 @@ void TestServer::enterKey(ItemPath path, int keyCode, unsigned modifiers)
 
 std::string TestServer::getStringProperty(ItemPath path, std::string propertyName)
 {
-    std::promise<std::string> promise;
-    auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::GetProperty>(path, std::move(propertyName), std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
-
-    return result.get();
+    return getStringPropertyAsync(std::move(path), std::move(propertyName)).get();
 }
 
 void TestServer::setStringProperty(ItemPath path, std::string propertyName, std::string propertyValue)
@@ -134,74 +149,334 @@ void TestServer::setStringProperty(ItemPath path, std::string propertyName, std:
     m_cmdExec->enqueueCommand<cmd::SetProperty>(path, std::move(propertyName), std::move(propertyValue));
 }
 
+std::vector<Variant::MapType> TestServer::getProperties(
+    std::vector<ItemPath> paths, std::vector<std::string> propertyNames)
+{
+    return getPropertiesAsync(std::move(paths), std::move(propertyNames)).get();
+}
+
 Variant TestServer::invokeMethod(ItemPath path, std::string method, std::vector<Variant> args)
+{
+    return invokeMethodAsync(std::move(path), std::move(method), std::move(args)).get();
+}
+
+Rect TestServer::getBoundingBox(ItemPath path)
+{
+    return getBoundingBoxAsync(std::move(path)).get();
+}
+
+bool TestServer::existsAndVisible(ItemPath path)
+{
+    return existsAndVisibleAsync(std::move(path)).get();
+}
+
+std::vector<std::string> TestServer::getErrors()
+{
+    return getErrorsAsync().get();
+}
+
+bool TestServer::waitForItem(ItemPath path, std::chrono::milliseconds maxWaitTime)
+{
+    return waitForItemAsync(std::move(path), maxWaitTime).get();
+}
+
+bool TestServer::waitForProperty(
+    ItemPath path, std::string propertyName, Variant expectedValue, std::chrono::milliseconds maxWaitTime)
+{
+    return waitForPropertyAsync(std::move(path), std::move(propertyName), std::move(expectedValue), maxWaitTime)
+        .get();
+}
+
+bool TestServer::waitForStableFrame(ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime)
+{
+    return waitForStableFrameAsync(std::move(path), consecutiveFrames, maxWaitTime).get();
+}
+
+Variant::MapType TestServer::getStatistics()
+{
+    return getStatisticsAsync().get();
+}
+
+int TestServer::subscribe(
+    ItemPath path, std::vector<std::string> propertyNames, std::chrono::milliseconds minInterval)
+{
+    return subscribeAsync(std::move(path), std::move(propertyNames), minInterval).get();
+}
+
+Variant::MapType TestServer::waitForChanges(int subscriptionId, std::chrono::milliseconds maxWaitTime)
+{
+    return waitForChangesAsync(subscriptionId, maxWaitTime).get();
+}
+
+void TestServer::unsubscribe(int subscriptionId)
+{
+    m_cmdExec->enqueueCommand<cmd::Unsubscribe>(subscriptionId);
+}
+
+void TestServer::takeScreenshot(ItemPath targetItem, std::string filePath)
+{
+    m_cmdExec->enqueueCommand<cmd::Screenshot>(targetItem, std::move(filePath));
+}
+
+std::string TestServer::takeScreenshotAsBase64(ItemPath targetItem)
+{
+    return takeScreenshotAsBase64Async(std::move(targetItem)).get();
+}
+
+EncodedImage TestServer::takeScreenshotEncoded(
+    ItemPath targetItem, ImageEncoding encoding, CaptureMode captureMode, CaptureOptions options)
+{
+    return takeScreenshotEncodedAsync(std::move(targetItem), encoding, captureMode, options).get();
+}
+
+std::vector<EncodedImage> TestServer::takeScreenshots(
+    std::vector<ItemPath> targetItems, ImageEncoding encoding, CaptureOptions options)
+{
+    return takeScreenshotsAsync(std::move(targetItems), encoding, options).get();
+}
+
+ImageComparison TestServer::compareScreenshot(
+    ItemPath targetItem, std::string goldenFilePath, int tolerance, bool createDiffImage)
+{
+    return compareScreenshotAsync(std::move(targetItem), std::move(goldenFilePath), tolerance, createDiffImage).get();
+}
+
+uint64_t TestServer::getImageHash(ItemPath targetItem, ImageHashAlgorithm algorithm)
+{
+    return getImageHashAsync(std::move(targetItem), algorithm).get();
+}
+
+SharedImage TestServer::takeScreenshotShared(ItemPath targetItem)
+{
+    return takeScreenshotSharedAsync(std::move(targetItem)).get();
+}
+
+void TestServer::releaseSharedScreenshot(std::string name)
+{
+    m_cmdExec->enqueueCommand<cmd::ReleaseSharedScreenshot>(std::move(name));
+}
+
+bool TestServer::startRecording(ItemPath windowPath, int fps, std::string filePath)
+{
+    return startRecordingAsync(std::move(windowPath), fps, std::move(filePath)).get();
+}
+
+RecordingStatistics TestServer::stopRecording()
+{
+    return stopRecordingAsync().get();
+}
+
+void TestServer::quit()
+{
+    m_cmdExec->enqueueCommand<cmd::Quit>();
+}
+
+// ####################
+// # Async Queries
+// ####################
+
+std::future<std::string> TestServer::getStringPropertyAsync(ItemPath path, std::string propertyName)
+{
+    std::promise<std::string> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::GetProperty>(std::move(path), std::move(propertyName), std::move(promise));
+
+    return result;
+}
+
+std::future<std::vector<Variant::MapType>> TestServer::getPropertiesAsync(
+    std::vector<ItemPath> paths, std::vector<std::string> propertyNames)
+{
+    std::promise<std::vector<Variant::MapType>> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::GetProperties>(std::move(paths), std::move(propertyNames), std::move(promise));
+
+    return result;
+}
+
+std::future<Variant> TestServer::invokeMethodAsync(ItemPath path, std::string method, std::vector<Variant> args)
 {
     std::promise<Variant> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::InvokeMethod>(path, std::move(method), std::move(args), std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::InvokeMethod>(
+        std::move(path), std::move(method), std::move(args), std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-Rect TestServer::getBoundingBox(ItemPath path)
+std::future<Rect> TestServer::getBoundingBoxAsync(ItemPath path)
 {
     std::promise<Rect> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::GetBoundingBox>(path, std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::GetBoundingBox>(std::move(path), std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-bool TestServer::existsAndVisible(ItemPath path)
+std::future<bool> TestServer::existsAndVisibleAsync(ItemPath path)
 {
     std::promise<bool> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::ExistsAndVisible>(path, std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::ExistsAndVisible>(std::move(path), std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-std::vector<std::string> TestServer::getErrors()
+std::future<std::vector<std::string>> TestServer::getErrorsAsync()
 {
     std::promise<std::vector<std::string>> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::GetTestStatus>(true, std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::GetTestStatus>(true, std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-bool TestServer::waitForItem(ItemPath path, std::chrono::milliseconds maxWaitTime)
+std::future<bool> TestServer::waitForItemAsync(ItemPath path, std::chrono::milliseconds maxWaitTime)
 {
     std::promise<bool> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::WaitForItem>(path, maxWaitTime, std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::WaitForItem>(std::move(path), maxWaitTime, std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-void TestServer::takeScreenshot(ItemPath targetItem, std::string filePath)
+std::future<bool> TestServer::waitForPropertyAsync(
+    ItemPath path, std::string propertyName, Variant expectedValue, std::chrono::milliseconds maxWaitTime)
 {
-    m_cmdExec->enqueueCommand<cmd::Screenshot>(targetItem, std::move(filePath));
+    std::promise<bool> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::WaitForProperty>(
+        std::move(path), std::move(propertyName), std::move(expectedValue), maxWaitTime, std::move(promise));
+
+    return result;
 }
 
-std::string TestServer::takeScreenshotAsBase64(ItemPath targetItem)
+std::future<bool> TestServer::waitForStableFrameAsync(
+    ItemPath path, int consecutiveFrames, std::chrono::milliseconds maxWaitTime)
+{
+    std::promise<bool> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::WaitForStableFrame>(
+        std::move(path), consecutiveFrames, maxWaitTime, std::move(promise));
+
+    return result;
+}
+
+std::future<Variant::MapType> TestServer::getStatisticsAsync()
+{
+    std::promise<Variant::MapType> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::GetStatistics>(std::move(promise));
+
+    return result;
+}
+
+std::future<int> TestServer::subscribeAsync(
+    ItemPath path, std::vector<std::string> propertyNames, std::chrono::milliseconds minInterval)
+{
+    std::promise<int> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::Subscribe>(
+        std::move(path), std::move(propertyNames), minInterval, std::move(promise));
+
+    return result;
+}
+
+std::future<Variant::MapType> TestServer::waitForChangesAsync(
+    int subscriptionId, std::chrono::milliseconds maxWaitTime)
+{
+    std::promise<Variant::MapType> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::WaitForChanges>(subscriptionId, maxWaitTime, std::move(promise));
+
+    return result;
+}
+
+std::future<bool> TestServer::takeScreenshotAsync(ItemPath targetItem, std::string filePath)
+{
+    std::promise<bool> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::Screenshot>(std::move(targetItem), std::move(filePath), std::move(promise));
+
+    return result;
+}
+
+std::future<std::string> TestServer::takeScreenshotAsBase64Async(ItemPath targetItem)
 {
     std::promise<std::string> promise;
     auto result = promise.get_future();
-    auto cmd = std::make_unique<cmd::ScreenshotAsBase64>(targetItem, std::move(promise));
-    m_cmdExec->enqueueCommand(std::move(cmd));
+    m_cmdExec->enqueueCommand<cmd::ScreenshotAsBase64>(std::move(targetItem), std::move(promise));
 
-    return result.get();
+    return result;
 }
 
-void TestServer::quit()
+std::future<EncodedImage> TestServer::takeScreenshotEncodedAsync(
+    ItemPath targetItem, ImageEncoding encoding, CaptureMode captureMode, CaptureOptions options)
 {
-    m_cmdExec->enqueueCommand<cmd::Quit>();
+    std::promise<EncodedImage> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::ScreenshotEncoded>(
+        std::move(targetItem), encoding, captureMode, options, std::move(promise));
+
+    return result;
+}
+
+std::future<std::vector<EncodedImage>> TestServer::takeScreenshotsAsync(
+    std::vector<ItemPath> targetItems, ImageEncoding encoding, CaptureOptions options)
+{
+    std::promise<std::vector<EncodedImage>> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::ScreenshotsEncoded>(
+        std::move(targetItems), encoding, options, std::move(promise));
+
+    return result;
+}
+
+std::future<ImageComparison> TestServer::compareScreenshotAsync(
+    ItemPath targetItem, std::string goldenFilePath, int tolerance, bool createDiffImage)
+{
+    std::promise<ImageComparison> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::CompareScreenshot>(
+        std::move(targetItem), std::move(goldenFilePath), tolerance, createDiffImage, std::move(promise));
+
+    return result;
+}
+
+std::future<uint64_t> TestServer::getImageHashAsync(ItemPath targetItem, ImageHashAlgorithm algorithm)
+{
+    std::promise<uint64_t> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::GetImageHash>(std::move(targetItem), algorithm, std::move(promise));
+
+    return result;
+}
+
+std::future<SharedImage> TestServer::takeScreenshotSharedAsync(ItemPath targetItem)
+{
+    std::promise<SharedImage> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::ScreenshotShared>(std::move(targetItem), std::move(promise));
+
+    return result;
+}
+
+std::future<bool> TestServer::startRecordingAsync(ItemPath windowPath, int fps, std::string filePath)
+{
+    std::promise<bool> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::StartRecording>(std::move(windowPath), fps, std::move(filePath), std::move(promise));
+
+    return result;
+}
+
+std::future<RecordingStatistics> TestServer::stopRecordingAsync()
+{
+    std::promise<RecordingStatistics> promise;
+    auto result = promise.get_future();
+    m_cmdExec->enqueueCommand<cmd::StopRecording>(std::move(promise));
+
+    return result;
 }
 
 } // namespace spix
@@ -10,6 +10,9 @@
 #include <Utils/AnyRpcUtils.h>
 #include <anyrpc/anyrpc.h>
 #include <functional>
+#include <future>
+#include <memory>
+#include <vector>
 
 /**
  * Utility type traits
@@ -116,10 +119,43 @@ std::vector<std::string> unpackAnyRpcParam(anyrpc::Value& value)
     return result;
 }
 
+/**
+ * Handler that assigns the result of a call once it is available.
+ **/
+using AnyRpcResultHandler = std::function<void(anyrpc::Value&)>;
+
+/**
+ * Set by AnyRpcBatchFunction while it issues a call. Functions that return
+ * a std::future then hand over a handler for their result instead of
+ * waiting for it.
+ **/
+inline AnyRpcResultHandler*& deferredAnyRpcResult()
+{
+    static thread_local AnyRpcResultHandler* handler = nullptr;
+    return handler;
+}
+
+template <typename T>
+void assignAnyRpcResult(const T& value, anyrpc::Value& result)
+{
+    if constexpr (is_specialization<T, std::vector>::value) {
+        result.SetArray();
+        for (const auto& item : value) {
+            anyrpc::Value itemValue {item};
+            result.PushBack(itemValue);
+        }
+    } else if constexpr (std::is_same_v<T, Variant>) {
+        result = VariantToAnyRPCValue(value);
+    } else {
+        result = value;
+    }
+}
+
 /**
  * Functions that call a std::function and assign its returned
  * value to the given anyrpc::Value. If the return type
  * of the std::function is 'void', no value is assigned.
+ * A returned std::future is waited for, unless a batch defers it.
  */
 
 template <typename R, typename... Args>
@@ -127,20 +163,16 @@ void callAndAssignAnyRpcResult(std::function<R(Args...)> func, anyrpc::Value& re
 {
     if constexpr (std::is_void_v<R>) {
         func(std::forward<Args>(args)...);
-    } else {
-        R funcResult = func(std::forward<Args>(args)...);
-
-        if constexpr (is_specialization<R, std::vector>::value) {
-            result.SetArray();
-            for (const auto& item : funcResult) {
-                anyrpc::Value value {item};
-                result.PushBack(value);
-            }
-        } else if constexpr (std::is_same_v<R, Variant>) {
-            result = VariantToAnyRPCValue(funcResult);
+    } else if constexpr (is_specialization<R, std::future>::value) {
+        auto future = std::make_shared<R>(func(std::forward<Args>(args)...));
+        AnyRpcResultHandler assignResult = [future](anyrpc::Value& value) { assignAnyRpcResult(future->get(), value); };
+        if (auto deferred = deferredAnyRpcResult()) {
+            *deferred = std::move(assignResult);
         } else {
-            result = funcResult;
+            assignResult(result);
         }
+    } else {
+        assignAnyRpcResult(func(std::forward<Args>(args)...), result);
     }
 }
 
@@ -195,5 +227,122 @@ void AddFunctionToAnyRpc(
     manager->AddMethod(new utils::AnyRpcFunction<F>(func, name, help, true));
 }
 
+/**
+ * AnyRPC method that executes a list of calls to other methods of
+ * the same MethodManager in one request.
+ *
+ * The only parameter is an array of structs of the form
+ * `{"method": name, "params": [...]}`. The result is an array with
+ * one struct per call, holding either the call's "result" (if it
+ * returns a value) or an "error" message.
+ *
+ * All calls are issued inside `runGroup`, which enqueues the commands
+ * they issue as one group. Results of methods that return a std::future
+ * are only waited for after all calls were issued.
+ **/
+class AnyRpcBatchFunction : public anyrpc::Method {
+public:
+    using GroupRunner = std::function<void(const std::function<void()>&)>;
+
+    AnyRpcBatchFunction(anyrpc::MethodManager* manager, GroupRunner runGroup, const std::string& name,
+        const std::string& help, bool deleteOnRemove = true)
+    : anyrpc::Method(name, help, deleteOnRemove)
+    , m_manager(manager)
+    , m_runGroup(std::move(runGroup))
+    {
+    }
+
+    void Execute(anyrpc::Value& params, anyrpc::Value& result) override
+    {
+        if (!params.IsArray() || params.Size() != 1 || !params[0].IsArray()) {
+            throw anyrpc::AnyRpcException(
+                anyrpc::AnyRpcErrorInvalidParams, "Invalid parameters. Expected Array of calls.");
+        }
+
+        anyrpc::Value& calls = params[0];
+        std::vector<PendingCall> pendingCalls(calls.Size());
+        m_runGroup([&] {
+            for (size_t i = 0; i < calls.Size(); ++i) {
+                issueCall(calls[i], pendingCalls[i]);
+            }
+        });
+
+        result.SetArray();
+        for (auto& pendingCall : pendingCalls) {
+            anyrpc::Value callResult;
+            completeCall(pendingCall, callResult);
+            result.PushBack(callResult);
+        }
+    }
+
+private:
+    struct PendingCall {
+        anyrpc::Value result;
+        AnyRpcResultHandler assignResult;
+        std::string error;
+    };
+
+    void issueCall(anyrpc::Value& call, PendingCall& pendingCall)
+    {
+        try {
+            if (call.GetType() != anyrpc::ValueType::MapType) {
+                throw anyrpc::AnyRpcException(
+                    anyrpc::AnyRpcErrorInvalidParams, "Invalid call. Expected {method, params} struct.");
+            }
+
+            std::string methodName;
+            anyrpc::Value methodParams;
+            methodParams.SetArray();
+            for (auto ptr = call.MemberBegin(); ptr != call.MemberEnd(); ptr++) {
+                anyrpc::Value key = ptr.GetKey();
+                anyrpc::Value value = ptr.GetValue();
+                if (!key.IsString()) {
+                    continue;
+                }
+                if (key.GetString() == std::string("method") && value.IsString()) {
+                    methodName = value.GetString();
+                } else if (key.GetString() == std::string("params")) {
+                    methodParams = value;
+                }
+            }
+
+            deferredAnyRpcResult() = &pendingCall.assignResult;
+            bool found = m_manager->ExecuteMethod(methodName, methodParams, pendingCall.result);
+            deferredAnyRpcResult() = nullptr;
+            if (!found) {
+                throw anyrpc::AnyRpcException(anyrpc::AnyRpcErrorInvalidParams, "Method not found: " + methodName);
+            }
+        } catch (const std::exception& e) {
+            deferredAnyRpcResult() = nullptr;
+            pendingCall.error = e.what();
+        }
+    }
+
+    void completeCall(PendingCall& pendingCall, anyrpc::Value& callResult)
+    {
+        callResult.SetMap();
+
+        if (pendingCall.error.empty() && pendingCall.assignResult) {
+            try {
+                pendingCall.assignResult(pendingCall.result);
+            } catch (const std::exception& e) {
+                pendingCall.error = e.what();
+            }
+        }
+
+        if (!pendingCall.error.empty()) {
+            std::string errorKey = "error";
+            anyrpc::Value message(pendingCall.error);
+            callResult.AddMember(errorKey, message);
+        } else if (pendingCall.result.GetType() != anyrpc::ValueType::InvalidType) {
+            std::string resultKey = "result";
+            callResult.AddMember(resultKey, pendingCall.result);
+        }
+    }
+
+    anyrpc::MethodManager* m_manager;
+    GroupRunner m_runGroup;
+};
+
 } // namespace utils
 } // namespace spix
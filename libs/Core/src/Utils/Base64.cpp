@@ -0,0 +1,45 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "Base64.h"
+
+namespace spix {
+namespace utils {
+
+std::string EncodeBase64(const std::string& data)
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string out;
+    out.reserve((data.size() + 2) / 3 * 4);
+
+    auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+    size_t i = 0;
+    for (; i + 2 < data.size(); i += 3) {
+        const unsigned value = bytes[i] << 16 | bytes[i + 1] << 8 | bytes[i + 2];
+        out.push_back(alphabet[(value >> 18) & 0x3f]);
+        out.push_back(alphabet[(value >> 12) & 0x3f]);
+        out.push_back(alphabet[(value >> 6) & 0x3f]);
+        out.push_back(alphabet[value & 0x3f]);
+    }
+
+    const size_t remaining = data.size() - i;
+    if (remaining > 0) {
+        unsigned value = bytes[i] << 16;
+        if (remaining == 2) {
+            value |= bytes[i + 1] << 8;
+        }
+        out.push_back(alphabet[(value >> 18) & 0x3f]);
+        out.push_back(alphabet[(value >> 12) & 0x3f]);
+        out.push_back(remaining == 2 ? alphabet[(value >> 6) & 0x3f] : '=');
+        out.push_back('=');
+    }
+
+    return out;
+}
+
+} // namespace utils
+} // namespace spix
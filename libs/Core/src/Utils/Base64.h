@@ -0,0 +1,20 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Encodes binary data as base64 (RFC 4648, with padding).
+ */
+std::string EncodeBase64(const std::string& data);
+
+} // namespace utils
+} // namespace spix
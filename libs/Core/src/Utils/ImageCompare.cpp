@@ -0,0 +1,133 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "ImageCompare.h"
+
+#include <Utils/QoiEncoder.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+constexpr unsigned char mismatchColor[] = {255, 0, 0, 255};
+
+// Kept free of branches, so that the compiler can vectorize it
+int MarkMismatches(const unsigned char* actual, const unsigned char* golden, int width, int tolerance,
+    unsigned char* mismatches)
+{
+    int count = 0;
+    for (int x = 0; x < width; ++x) {
+        const unsigned char* a = actual + x * 4;
+        const unsigned char* g = golden + x * 4;
+        int difference = std::max(std::max(std::abs(a[0] - g[0]), std::abs(a[1] - g[1])),
+            std::max(std::abs(a[2] - g[2]), std::abs(a[3] - g[3])));
+        mismatches[x] = difference > tolerance;
+        count += mismatches[x];
+    }
+    return count;
+}
+
+// Matching pixels are shown as a light gray version of the screenshot
+void WriteDiffRow(const unsigned char* actual, const unsigned char* mismatches, int width, unsigned char* diff)
+{
+    for (int x = 0; x < width; ++x) {
+        const unsigned char* a = actual + x * 4;
+        unsigned char* d = diff + x * 4;
+        if (mismatches && mismatches[x]) {
+            std::memcpy(d, mismatchColor, 4);
+        } else {
+            auto gray = static_cast<unsigned char>(191 + (a[0] + a[1] + a[2]) / 12);
+            d[0] = d[1] = d[2] = gray;
+            d[3] = 255;
+        }
+    }
+}
+
+} // namespace
+
+ImageComparison CompareImages(const RgbaImage& actual, const RgbaImage& golden, int tolerance, bool createDiffImage)
+{
+    ImageComparison result;
+    const long long pixelCount = static_cast<long long>(actual.width) * actual.height;
+
+    result.sizeMatches = actual.width == golden.width && actual.height == golden.height
+        && actual.pixels.size() == golden.pixels.size();
+    if (!result.sizeMatches) {
+        result.mismatchedPixels = pixelCount;
+        result.mismatchPercent = 100.0;
+        result.changedRegion = Rect(0, 0, actual.width, actual.height);
+        if (createDiffImage) {
+            std::string diff;
+            diff.reserve(static_cast<size_t>(pixelCount) * 4);
+            for (long long i = 0; i < pixelCount; ++i) {
+                diff.append(reinterpret_cast<const char*>(mismatchColor), 4);
+            }
+            result.diffImage = EncodeQoi(diff, actual.width, actual.height);
+        }
+        return result;
+    }
+
+    const int width = actual.width;
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    const auto* actualPixels = reinterpret_cast<const unsigned char*>(actual.pixels.data());
+    const auto* goldenPixels = reinterpret_cast<const unsigned char*>(golden.pixels.data());
+
+    std::string diff;
+    if (createDiffImage) {
+        diff.resize(actual.pixels.size());
+    }
+    auto* diffPixels = reinterpret_cast<unsigned char*>(&diff[0]);
+
+    std::vector<unsigned char> mismatches(width);
+    int minX = width, maxX = -1, minY = actual.height, maxY = -1;
+
+    for (int y = 0; y < actual.height; ++y) {
+        const auto* actualRow = actualPixels + y * rowBytes;
+        const auto* goldenRow = goldenPixels + y * rowBytes;
+
+        int rowMismatches = 0;
+        if (std::memcmp(actualRow, goldenRow, rowBytes) != 0) {
+            rowMismatches = MarkMismatches(actualRow, goldenRow, width, tolerance, mismatches.data());
+        }
+
+        if (createDiffImage) {
+            WriteDiffRow(actualRow, rowMismatches ? mismatches.data() : nullptr, width, diffPixels + y * rowBytes);
+        }
+        if (rowMismatches == 0) {
+            continue;
+        }
+
+        result.mismatchedPixels += rowMismatches;
+        minY = std::min(minY, y);
+        maxY = y;
+        auto first = std::find(mismatches.begin(), mismatches.end(), 1) - mismatches.begin();
+        auto last = mismatches.rend() - std::find(mismatches.rbegin(), mismatches.rend(), 1) - 1;
+        minX = std::min(minX, static_cast<int>(first));
+        maxX = std::max(maxX, static_cast<int>(last));
+    }
+
+    if (pixelCount > 0) {
+        result.mismatchPercent = 100.0 * result.mismatchedPixels / pixelCount;
+    }
+    if (result.mismatchedPixels > 0) {
+        result.changedRegion = Rect(minX, minY, maxX - minX + 1, maxY - minY + 1);
+    }
+    if (createDiffImage) {
+        result.diffImage = EncodeQoi(diff, actual.width, actual.height);
+    }
+
+    return result;
+}
+
+} // namespace utils
+} // namespace spix
@@ -0,0 +1,30 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Data/ImageComparison.h>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Compares a screenshot with a golden image, pixel by pixel.
+ *
+ * Rows that are identical are skipped with a `memcmp`, so that the cost
+ * of comparing mostly unchanged UIs is close to a memory scan. Only rows
+ * that differ are compared channel by channel.
+ *
+ * @param actual          The screenshot
+ * @param golden          The reference image
+ * @param tolerance       Largest difference of a channel (0-255) that still counts as equal
+ * @param createDiffImage Also create a QOI encoded diff image of the size of `actual`
+ */
+ImageComparison CompareImages(
+    const RgbaImage& actual, const RgbaImage& golden, int tolerance, bool createDiffImage = false);
+
+} // namespace utils
+} // namespace spix
@@ -0,0 +1,124 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "PerceptualHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+constexpr double pi = 3.14159265358979323846;
+
+/// Gray values of the image scaled to `targetWidth` x `targetHeight` by averaging
+std::vector<double> GrayThumbnail(
+    const std::string& rgbaPixels, int width, int height, int targetWidth, int targetHeight)
+{
+    if (width < 0 || height < 0 || rgbaPixels.size() != static_cast<size_t>(width) * height * 4) {
+        throw std::invalid_argument("Image hash: pixel data does not match the image size");
+    }
+
+    std::vector<double> sums(static_cast<size_t>(targetWidth) * targetHeight, 0.0);
+    std::vector<int> counts(sums.size(), 0);
+    const auto* pixels = reinterpret_cast<const unsigned char*>(rgbaPixels.data());
+
+    for (int y = 0; y < height; ++y) {
+        const int cellRow = y * targetHeight / height * targetWidth;
+        for (int x = 0; x < width; ++x) {
+            const auto* pixel = pixels + (static_cast<size_t>(y) * width + x) * 4;
+            const int cell = cellRow + x * targetWidth / width;
+            sums[cell] += 0.299 * pixel[0] + 0.587 * pixel[1] + 0.114 * pixel[2];
+            ++counts[cell];
+        }
+    }
+
+    // cells of images smaller than the thumbnail get the value of the nearest pixel
+    for (int ty = 0; ty < targetHeight; ++ty) {
+        for (int tx = 0; tx < targetWidth; ++tx) {
+            auto cell = static_cast<size_t>(ty) * targetWidth + tx;
+            if (counts[cell] > 0) {
+                sums[cell] /= counts[cell];
+            } else if (width > 0 && height > 0) {
+                const auto* pixel
+                    = pixels + (static_cast<size_t>(ty * height / targetHeight) * width + tx * width / targetWidth) * 4;
+                sums[cell] = 0.299 * pixel[0] + 0.587 * pixel[1] + 0.114 * pixel[2];
+            }
+        }
+    }
+
+    return sums;
+}
+
+} // namespace
+
+uint64_t DifferenceHash(const std::string& rgbaPixels, int width, int height)
+{
+    auto gray = GrayThumbnail(rgbaPixels, width, height, 9, 8);
+
+    uint64_t hash = 0;
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            hash = (hash << 1) | (gray[y * 9 + x + 1] > gray[y * 9 + x] ? 1 : 0);
+        }
+    }
+    return hash;
+}
+
+uint64_t PerceptualHash(const std::string& rgbaPixels, int width, int height)
+{
+    constexpr int size = 32;
+    constexpr int lowFrequencies = 8;
+    auto gray = GrayThumbnail(rgbaPixels, width, height, size, size);
+
+    // only the lowest frequencies are needed, so the DCT is computed for those
+    double cosines[lowFrequencies][size];
+    for (int u = 0; u < lowFrequencies; ++u) {
+        for (int x = 0; x < size; ++x) {
+            cosines[u][x] = std::cos((2 * x + 1) * u * pi / (2 * size));
+        }
+    }
+
+    // rows first, then columns
+    std::vector<double> rows(static_cast<size_t>(size) * lowFrequencies);
+    for (int y = 0; y < size; ++y) {
+        for (int u = 0; u < lowFrequencies; ++u) {
+            double sum = 0.0;
+            for (int x = 0; x < size; ++x) {
+                sum += gray[y * size + x] * cosines[u][x];
+            }
+            rows[y * lowFrequencies + u] = sum;
+        }
+    }
+
+    std::vector<double> frequencies(lowFrequencies * lowFrequencies);
+    for (int v = 0; v < lowFrequencies; ++v) {
+        for (int u = 0; u < lowFrequencies; ++u) {
+            double sum = 0.0;
+            for (int y = 0; y < size; ++y) {
+                sum += rows[y * lowFrequencies + u] * cosines[v][y];
+            }
+            frequencies[v * lowFrequencies + u] = sum;
+        }
+    }
+
+    auto sorted = frequencies;
+    std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    const double median = sorted[sorted.size() / 2];
+
+    uint64_t hash = 0;
+    for (double frequency : frequencies) {
+        hash = (hash << 1) | (frequency > median ? 1 : 0);
+    }
+    return hash;
+}
+
+} // namespace utils
+} // namespace spix
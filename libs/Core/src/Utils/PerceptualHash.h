@@ -0,0 +1,36 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Difference hash (dHash) of RGBA pixels.
+ *
+ * The image is scaled down to 9x8 gray values. Each of the 64 bits tells
+ * whether a value is brighter than its left neighbour, row by row with the
+ * first comparison in the highest bit. Very cheap and robust against
+ * scaling and small color changes.
+ */
+uint64_t DifferenceHash(const std::string& rgbaPixels, int width, int height);
+
+/**
+ * Perceptual hash (pHash) of RGBA pixels.
+ *
+ * The image is scaled down to 32x32 gray values and transformed with a
+ * DCT. Each of the 64 bits tells whether one of the 8x8 lowest frequencies
+ * is above their median. More robust than dHash against small changes of
+ * brightness, contrast or rendering.
+ */
+uint64_t PerceptualHash(const std::string& rgbaPixels, int width, int height);
+
+} // namespace utils
+} // namespace spix
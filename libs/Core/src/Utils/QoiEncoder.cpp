@@ -0,0 +1,133 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QoiEncoder.h"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+constexpr unsigned char QOI_OP_INDEX = 0x00;
+constexpr unsigned char QOI_OP_DIFF = 0x40;
+constexpr unsigned char QOI_OP_LUMA = 0x80;
+constexpr unsigned char QOI_OP_RUN = 0xc0;
+constexpr unsigned char QOI_OP_RGB = 0xfe;
+constexpr unsigned char QOI_OP_RGBA = 0xff;
+constexpr int maxRunLength = 62;
+
+struct Pixel {
+    unsigned char r = 0;
+    unsigned char g = 0;
+    unsigned char b = 0;
+    unsigned char a = 0;
+
+    bool operator==(const Pixel& other) const
+    {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+    int hash() const { return (r * 3 + g * 5 + b * 7 + a * 11) % 64; }
+};
+
+void AppendUint32(std::string& out, uint32_t value)
+{
+    out.push_back(static_cast<char>((value >> 24) & 0xff));
+    out.push_back(static_cast<char>((value >> 16) & 0xff));
+    out.push_back(static_cast<char>((value >> 8) & 0xff));
+    out.push_back(static_cast<char>(value & 0xff));
+}
+
+} // namespace
+
+std::string EncodeQoi(const std::string& rgbaPixels, int width, int height)
+{
+    const size_t pixelCount = static_cast<size_t>(width) * static_cast<size_t>(height);
+    if (width < 0 || height < 0 || rgbaPixels.size() != pixelCount * 4) {
+        throw std::invalid_argument("EncodeQoi: pixel data does not match the image size");
+    }
+
+    std::string out;
+    // worst case: header, one RGBA op per pixel and end marker
+    out.reserve(14 + pixelCount * 5 + 8);
+
+    out.append("qoif");
+    AppendUint32(out, static_cast<uint32_t>(width));
+    AppendUint32(out, static_cast<uint32_t>(height));
+    out.push_back(4); // channels
+    out.push_back(0); // sRGB with linear alpha
+
+    std::array<Pixel, 64> index {};
+    Pixel previous;
+    previous.a = 255;
+    int run = 0;
+
+    auto data = reinterpret_cast<const unsigned char*>(rgbaPixels.data());
+    for (size_t i = 0; i < pixelCount; ++i) {
+        Pixel pixel {data[i * 4], data[i * 4 + 1], data[i * 4 + 2], data[i * 4 + 3]};
+
+        if (pixel == previous) {
+            ++run;
+            if (run == maxRunLength || i == pixelCount - 1) {
+                out.push_back(static_cast<char>(QOI_OP_RUN | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0) {
+            out.push_back(static_cast<char>(QOI_OP_RUN | (run - 1)));
+            run = 0;
+        }
+
+        const int indexPosition = pixel.hash();
+        if (index[indexPosition] == pixel) {
+            out.push_back(static_cast<char>(QOI_OP_INDEX | indexPosition));
+        } else {
+            index[indexPosition] = pixel;
+
+            if (pixel.a == previous.a) {
+                const signed char vr = static_cast<signed char>(pixel.r - previous.r);
+                const signed char vg = static_cast<signed char>(pixel.g - previous.g);
+                const signed char vb = static_cast<signed char>(pixel.b - previous.b);
+                const signed char vgR = static_cast<signed char>(vr - vg);
+                const signed char vgB = static_cast<signed char>(vb - vg);
+
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                    out.push_back(static_cast<char>(QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+                } else if (vgR > -9 && vgR < 8 && vg > -33 && vg < 32 && vgB > -9 && vgB < 8) {
+                    out.push_back(static_cast<char>(QOI_OP_LUMA | (vg + 32)));
+                    out.push_back(static_cast<char>((vgR + 8) << 4 | (vgB + 8)));
+                } else {
+                    out.push_back(static_cast<char>(QOI_OP_RGB));
+                    out.push_back(static_cast<char>(pixel.r));
+                    out.push_back(static_cast<char>(pixel.g));
+                    out.push_back(static_cast<char>(pixel.b));
+                }
+            } else {
+                out.push_back(static_cast<char>(QOI_OP_RGBA));
+                out.push_back(static_cast<char>(pixel.r));
+                out.push_back(static_cast<char>(pixel.g));
+                out.push_back(static_cast<char>(pixel.b));
+                out.push_back(static_cast<char>(pixel.a));
+            }
+        }
+
+        previous = pixel;
+    }
+
+    // end marker
+    out.append(7, '\0');
+    out.push_back(1);
+
+    return out;
+}
+
+} // namespace utils
+} // namespace spix
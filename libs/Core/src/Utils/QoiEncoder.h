@@ -0,0 +1,28 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Encodes RGBA pixels in the "Quite OK Image" format (https://qoiformat.org).
+ *
+ * QOI is lossless and encodes an order of magnitude faster than PNG,
+ * at a similar size for typical UI content.
+ *
+ * @param rgbaPixels RGBA pixels, 8 bits per channel, rows without padding
+ * @param width      Width of the image in pixels
+ * @param height     Height of the image in pixels
+ * @return The encoded image, including the QOI header
+ */
+std::string EncodeQoi(const std::string& rgbaPixels, int width, int height);
+
+} // namespace utils
+} // namespace spix
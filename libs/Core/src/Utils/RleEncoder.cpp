@@ -0,0 +1,88 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "RleEncoder.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+void AppendVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void AppendPacket(std::string& out, const char* pixels, size_t count, bool isRun)
+{
+    AppendVarint(out, (static_cast<uint64_t>(count) << 1) | (isRun ? 1 : 0));
+    out.append(pixels, isRun ? 4 : count * 4);
+}
+
+} // namespace
+
+std::string EncodeRle(const std::string& rgbaPixels, const std::string* previousPixels)
+{
+    if (rgbaPixels.size() % 4 != 0 || (previousPixels && previousPixels->size() != rgbaPixels.size())) {
+        throw std::invalid_argument("EncodeRle: pixel data does not match the frame size");
+    }
+
+    const size_t pixelCount = rgbaPixels.size() / 4;
+
+    std::string pixels;
+    const std::string* input = &rgbaPixels;
+    if (previousPixels) {
+        pixels.resize(rgbaPixels.size());
+        for (size_t i = 0; i < rgbaPixels.size(); ++i) {
+            pixels[i] = static_cast<char>(rgbaPixels[i] ^ (*previousPixels)[i]);
+        }
+        input = &pixels;
+    }
+    const char* data = input->data();
+
+    auto pixelAt = [data](size_t index) {
+        uint32_t pixel;
+        std::memcpy(&pixel, data + index * 4, 4);
+        return pixel;
+    };
+
+    std::string out;
+    size_t literalStart = 0;
+    size_t i = 0;
+    while (i < pixelCount) {
+        size_t runEnd = i + 1;
+        const auto pixel = pixelAt(i);
+        while (runEnd < pixelCount && pixelAt(runEnd) == pixel) {
+            ++runEnd;
+        }
+
+        // a run of two pixels is not shorter than a literal
+        if (runEnd - i >= 3) {
+            if (literalStart < i) {
+                AppendPacket(out, data + literalStart * 4, i - literalStart, false);
+            }
+            AppendPacket(out, data + i * 4, runEnd - i, true);
+            literalStart = runEnd;
+        }
+        i = runEnd;
+    }
+    if (literalStart < pixelCount) {
+        AppendPacket(out, data + literalStart * 4, pixelCount - literalStart, false);
+    }
+
+    return out;
+}
+
+} // namespace utils
+} // namespace spix
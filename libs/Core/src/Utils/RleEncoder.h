@@ -0,0 +1,31 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Run-length encodes RGBA pixels, optionally as delta to a previous frame.
+ *
+ * With a previous frame, each pixel is XORed with the pixel at the same
+ * position first. Unchanged areas then become long runs of zeros, so an
+ * unchanged frame is encoded in a few bytes.
+ *
+ * The output is a sequence of packets. Each packet starts with a LEB128
+ * varint `count << 1 | isRun`. A run is followed by one 4 byte pixel that
+ * repeats `count` times, a literal by `count` pixels.
+ *
+ * @param rgbaPixels     RGBA pixels, 8 bits per channel
+ * @param previousPixels Pixels of the previous frame of the same size, or nullptr
+ */
+std::string EncodeRle(const std::string& rgbaPixels, const std::string* previousPixels = nullptr);
+
+} // namespace utils
+} // namespace spix
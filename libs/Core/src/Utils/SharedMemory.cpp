@@ -0,0 +1,117 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "SharedMemory.h"
+
+#include <atomic>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+// Short enough for the 31 character limit of shared memory names on macOS
+std::string UniqueName()
+{
+    static std::atomic<unsigned> counter {0};
+#ifdef _WIN32
+    auto pid = static_cast<unsigned long>(GetCurrentProcessId());
+#else
+    auto pid = static_cast<unsigned long>(getpid());
+#endif
+    return "spix-" + std::to_string(pid) + "-" + std::to_string(++counter);
+}
+
+} // namespace
+
+#ifdef _WIN32
+
+std::unique_ptr<SharedMemory> SharedMemory::create(size_t size)
+{
+    std::unique_ptr<SharedMemory> memory(new SharedMemory);
+    memory->m_name = UniqueName();
+    memory->m_size = size;
+
+    auto size64 = static_cast<unsigned long long>(size);
+    memory->m_handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), memory->m_name.c_str());
+    if (!memory->m_handle) {
+        return {};
+    }
+
+    memory->m_data = static_cast<char*>(MapViewOfFile(memory->m_handle, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    if (!memory->m_data) {
+        return {};
+    }
+
+    return memory;
+}
+
+SharedMemory::~SharedMemory()
+{
+    // the mapping disappears once the last process closed its handle
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_handle) {
+        CloseHandle(m_handle);
+    }
+}
+
+#else
+
+std::unique_ptr<SharedMemory> SharedMemory::create(size_t size)
+{
+    auto name = UniqueName();
+    auto posixName = "/" + name;
+    int fd = shm_open(posixName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return {};
+    }
+
+    // from here on, the destructor removes the segment
+    std::unique_ptr<SharedMemory> memory(new SharedMemory);
+    memory->m_name = std::move(name);
+
+    void* data = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (data == MAP_FAILED) {
+        return {};
+    }
+
+    memory->m_data = static_cast<char*>(data);
+    memory->m_size = size;
+    return memory;
+}
+
+SharedMemory::~SharedMemory()
+{
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    if (!m_name.empty()) {
+        shm_unlink(("/" + m_name).c_str());
+    }
+}
+
+#endif
+
+} // namespace utils
+} // namespace spix
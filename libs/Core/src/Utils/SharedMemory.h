@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * @brief A named shared memory segment that other processes can map
+ *
+ * Uses POSIX shared memory (`/dev/shm` on Linux) or a named file mapping
+ * on Windows. The segment is removed when the object is destroyed, but
+ * processes that already mapped it keep their mapping.
+ */
+class SharedMemory {
+public:
+    /**
+     * @brief Create a segment with a unique name, or return nullptr on failure
+     */
+    static std::unique_ptr<SharedMemory> create(size_t size);
+
+    ~SharedMemory();
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    /// The name without the leading '/' of POSIX names
+    const std::string& name() const { return m_name; }
+    char* data() { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    SharedMemory() = default;
+
+    std::string m_name;
+    char* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_handle = nullptr;
+#endif
+};
+
+} // namespace utils
+} // namespace spix
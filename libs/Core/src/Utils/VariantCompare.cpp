@@ -0,0 +1,87 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "VariantCompare.h"
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+bool IsNumber(const Variant& value)
+{
+    auto type = value.index();
+    return type == Variant::Int || type == Variant::Uint || type == Variant::Double;
+}
+
+double ToDouble(const Variant& value)
+{
+    switch (value.index()) {
+    case Variant::Int:
+        return static_cast<double>(std::get<long long>(value.base()));
+    case Variant::Uint:
+        return static_cast<double>(std::get<unsigned long long>(value.base()));
+    default:
+        return std::get<double>(value.base());
+    }
+}
+
+} // namespace
+
+bool VariantsEqual(const Variant& a, const Variant& b)
+{
+    if (IsNumber(a) && IsNumber(b)) {
+        return ToDouble(a) == ToDouble(b);
+    }
+    if (a.index() != b.index()) {
+        return false;
+    }
+
+    switch (a.index()) {
+    case Variant::Nullptr:
+        return true;
+    case Variant::Bool:
+        return std::get<bool>(a.base()) == std::get<bool>(b.base());
+    case Variant::String:
+        return std::get<std::string>(a.base()) == std::get<std::string>(b.base());
+    case Variant::Time: {
+        using Time = std::chrono::time_point<std::chrono::system_clock>;
+        return std::get<Time>(a.base()) == std::get<Time>(b.base());
+    }
+    case Variant::List: {
+        const auto& listA = std::get<Variant::ListType>(a.base());
+        const auto& listB = std::get<Variant::ListType>(b.base());
+        if (listA.size() != listB.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < listA.size(); ++i) {
+            if (!VariantsEqual(listA[i], listB[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    case Variant::Map: {
+        const auto& mapA = std::get<Variant::MapType>(a.base());
+        const auto& mapB = std::get<Variant::MapType>(b.base());
+        if (mapA.size() != mapB.size()) {
+            return false;
+        }
+        for (const auto& entry : mapA) {
+            auto entryB = mapB.find(entry.first);
+            if (entryB == mapB.end() || !VariantsEqual(entry.second, entryB->second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+} // namespace utils
+} // namespace spix
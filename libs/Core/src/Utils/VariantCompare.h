@@ -0,0 +1,24 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Data/Variant.h>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Compares two variants by value.
+ *
+ * Numbers are equal if their values are, regardless of whether they are
+ * signed, unsigned or floating point. Lists and maps are compared element
+ * by element. All other values are only equal to values of the same type.
+ */
+bool VariantsEqual(const Variant& a, const Variant& b);
+
+} // namespace utils
+} // namespace spix
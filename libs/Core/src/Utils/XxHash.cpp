@@ -0,0 +1,120 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "XxHash.h"
+
+#include <cstring>
+
+namespace spix {
+namespace utils {
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+uint64_t RotateLeft(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// xxHash is defined on little endian values
+uint64_t Read64(const unsigned char* data)
+{
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+uint32_t Read32(const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+        | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint64_t Round(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * prime2;
+    accumulator = RotateLeft(accumulator, 31);
+    return accumulator * prime1;
+}
+
+uint64_t MergeRound(uint64_t hash, uint64_t accumulator)
+{
+    hash ^= Round(0, accumulator);
+    return hash * prime1 + prime4;
+}
+
+} // namespace
+
+uint64_t XxHash64(const void* data, size_t size, uint64_t seed)
+{
+    const auto* input = static_cast<const unsigned char*>(data);
+    const auto* end = input + size;
+    uint64_t hash;
+
+    if (size >= 32) {
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+
+        const auto* limit = end - 32;
+        do {
+            v1 = Round(v1, Read64(input));
+            v2 = Round(v2, Read64(input + 8));
+            v3 = Round(v3, Read64(input + 16));
+            v4 = Round(v4, Read64(input + 24));
+            input += 32;
+        } while (input <= limit);
+
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    } else {
+        hash = seed + prime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (input + 8 <= end) {
+        hash ^= Round(0, Read64(input));
+        hash = RotateLeft(hash, 27) * prime1 + prime4;
+        input += 8;
+    }
+    if (input + 4 <= end) {
+        hash ^= static_cast<uint64_t>(Read32(input)) * prime1;
+        hash = RotateLeft(hash, 23) * prime2 + prime3;
+        input += 4;
+    }
+    while (input < end) {
+        hash ^= (*input) * prime5;
+        hash = RotateLeft(hash, 11) * prime1;
+        ++input;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+uint64_t XxHash64(const std::string& data, uint64_t seed)
+{
+    return XxHash64(data.data(), data.size(), seed);
+}
+
+} // namespace utils
+} // namespace spix
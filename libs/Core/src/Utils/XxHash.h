@@ -0,0 +1,26 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace spix {
+namespace utils {
+
+/**
+ * Computes the 64 bit xxHash (XXH64) of the data.
+ *
+ * xxHash is a non-cryptographic hash that runs at memory speed, so
+ * hashing a screenshot costs far less than capturing it.
+ */
+uint64_t XxHash64(const void* data, size_t size, uint64_t seed = 0);
+uint64_t XxHash64(const std::string& data, uint64_t seed = 0);
+
+} // namespace utils
+} // namespace spix
@@ -6,7 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+#include <thread>
+
 #include <Commands/CustomCmd.h>
+#include <Commands/Wait.h>
 #include <Scene/Mock/MockScene.h>
 #include <Spix/CommandExecuter/CommandExecuter.h>
 #include <Spix/Commands/Command.h>
@@ -103,3 +107,142 @@ TEST(CommandExecuterTest, NoBreakOnError)
     EXPECT_TRUE(didExec2ndCommand);
     EXPECT_EQ(exec.state().errorsDescription(), "Some Error Happened");
 }
+
+TEST(CommandExecuterTest, WakeupHandler)
+{
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+
+    int wakeups = 0;
+    exec.setWakeupHandler([&] { ++wakeups; });
+
+    // Several commands enqueued before the queue is processed only wake up once
+    exec.enqueueCommand(std::make_unique<spix::cmd::CustomCmd>([](spix::CommandEnvironment&) {}, [] { return true; }));
+    exec.enqueueCommand(std::make_unique<spix::cmd::CustomCmd>([](spix::CommandEnvironment&) {}, [] { return true; }));
+    EXPECT_EQ(wakeups, 1);
+
+    exec.processCommands(scene);
+    EXPECT_FALSE(exec.hasPendingCommands());
+
+    // After processing, the next command wakes up the executer again
+    exec.enqueueCommand(std::make_unique<spix::cmd::CustomCmd>([](spix::CommandEnvironment&) {}, [] { return true; }));
+    EXPECT_EQ(wakeups, 2);
+    EXPECT_TRUE(exec.hasPendingCommands());
+}
+
+TEST(CommandExecuterTest, PendingWhileBlocked)
+{
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+
+    bool canExec = false;
+    exec.enqueueCommand(
+        std::make_unique<spix::cmd::CustomCmd>([](spix::CommandEnvironment&) {}, [&] { return canExec; }));
+
+    exec.processCommands(scene);
+    EXPECT_TRUE(exec.hasPendingCommands());
+
+    canExec = true;
+    exec.processCommands(scene);
+    EXPECT_FALSE(exec.hasPendingCommands());
+}
+
+TEST(CommandExecuterTest, WaitingCommandOnlyBlocksItsLane)
+{
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+
+    std::vector<int> executed;
+    bool canExec1 = false;
+    auto makeCmd = [&](int id, std::function<bool()> canExecute) {
+        return std::make_unique<spix::cmd::CustomCmd>(
+            [&executed, id](spix::CommandEnvironment&) { executed.push_back(id); }, std::move(canExecute));
+    };
+
+    // Both threads are alive at the same time, so that they have different ids
+    std::promise<void> firstLaneEnqueued;
+    std::thread firstLane([&] {
+        exec.enqueueCommand(makeCmd(1, [&] { return canExec1; }));
+        exec.enqueueCommand(makeCmd(2, [] { return true; }));
+        firstLaneEnqueued.set_value();
+    });
+    std::thread secondLane([&] {
+        firstLaneEnqueued.get_future().wait();
+        exec.enqueueCommand(makeCmd(3, [] { return true; }));
+    });
+    secondLane.join();
+    firstLane.join();
+
+    // The command of the second lane does not wait behind the first lane
+    exec.processCommands(scene);
+    EXPECT_EQ(executed, (std::vector<int> {3}));
+    EXPECT_TRUE(exec.hasPendingCommands());
+
+    canExec1 = true;
+    exec.processCommands(scene);
+    EXPECT_EQ(executed, (std::vector<int> {3, 1, 2}));
+    EXPECT_FALSE(exec.hasPendingCommands());
+}
+
+TEST(CommandExecuterTest, CommandGroup)
+{
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+
+    std::vector<int> executed;
+    bool canExec2 = false;
+    auto makeCmd = [&](int id, std::function<bool()> canExecute) {
+        return std::make_unique<spix::cmd::CustomCmd>(
+            [&executed, id](spix::CommandEnvironment&) { executed.push_back(id); }, std::move(canExecute));
+    };
+
+    // The group is only enqueued once it is complete, so the command of the
+    // other lane is older and the group's commands are not split by it
+    exec.enqueueCommandGroup([&] {
+        exec.enqueueCommand(makeCmd(1, [] { return true; }));
+        std::thread otherLane([&] { exec.enqueueCommand(makeCmd(3, [] { return true; })); });
+        otherLane.join();
+        exec.enqueueCommand(makeCmd(2, [&] { return canExec2; }));
+        exec.enqueueCommand(makeCmd(4, [] { return true; }));
+    });
+
+    exec.processCommands(scene);
+    EXPECT_EQ(executed, (std::vector<int> {3, 1}));
+    EXPECT_TRUE(exec.hasPendingCommands());
+
+    canExec2 = true;
+    exec.processCommands(scene);
+    EXPECT_EQ(executed, (std::vector<int> {3, 1, 2, 4}));
+    EXPECT_FALSE(exec.hasPendingCommands());
+}
+
+TEST(CommandExecuterTest, NextCheckDelay)
+{
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+    const std::chrono::milliseconds pollingInterval(10);
+
+    // A wait is only checked again at its deadline
+    exec.enqueueCommand<spix::cmd::Wait>(std::chrono::milliseconds(1000));
+    exec.processCommands(scene);
+    ASSERT_TRUE(exec.hasPendingCommands());
+    auto delay = exec.nextCheckDelay(pollingInterval);
+    EXPECT_GT(delay, std::chrono::milliseconds(900));
+    EXPECT_LE(delay, std::chrono::milliseconds(1000));
+
+    // A command that waits for a condition is polled
+    bool canExec = false;
+    std::thread otherLane([&] {
+        exec.enqueueCommand(
+            std::make_unique<spix::cmd::CustomCmd>([](spix::CommandEnvironment&) {}, [&] { return canExec; }));
+    });
+    otherLane.join();
+    exec.processCommands(scene);
+    EXPECT_EQ(exec.nextCheckDelay(pollingInterval), pollingInterval);
+
+    // Without it, the executer can sleep until the deadline again
+    canExec = true;
+    exec.processCommands(scene);
+    EXPECT_TRUE(exec.hasPendingCommands());
+    EXPECT_GT(exec.nextCheckDelay(pollingInterval), pollingInterval);
+}
@@ -0,0 +1,144 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <Commands/CustomCmd.h>
+#include <Scene/Mock/MockScene.h>
+#include <Spix/CommandExecuter/CommandExecuter.h>
+#include <Spix/CommandExecuter/CommandQueue.h>
+
+namespace {
+
+class IdCmd : public spix::cmd::Command {
+public:
+    IdCmd(int producer, int index)
+    : producer(producer)
+    , index(index)
+    {
+    }
+
+    void execute(spix::CommandEnvironment&) override {}
+
+    int producer;
+    int index;
+};
+
+} // namespace
+
+TEST(CommandQueueTest, FrontAndPop)
+{
+    spix::CommandQueue queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.front(), nullptr);
+    EXPECT_EQ(queue.pop(), nullptr);
+
+    queue.push(std::make_unique<IdCmd>(0, 1));
+    queue.push(std::make_unique<IdCmd>(0, 2));
+    EXPECT_FALSE(queue.empty());
+
+    // front does not remove the command
+    EXPECT_EQ(static_cast<IdCmd*>(queue.front())->index, 1);
+    EXPECT_EQ(static_cast<IdCmd*>(queue.front())->index, 1);
+
+    auto first = queue.pop();
+    EXPECT_EQ(static_cast<IdCmd*>(first.get())->index, 1);
+    auto second = queue.pop();
+    EXPECT_EQ(static_cast<IdCmd*>(second.get())->index, 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(CommandQueueTest, ManyProducersStress)
+{
+    constexpr int producers = 8;
+    constexpr int commandsPerProducer = 20000;
+
+    spix::CommandQueue queue;
+    std::atomic<int> startedProducers {0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            ++startedProducers;
+            while (startedProducers.load() < producers) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < commandsPerProducer; ++i) {
+                queue.push(std::make_unique<IdCmd>(p, i));
+            }
+        });
+    }
+
+    // Consume while the producers are running. The commands of each
+    // producer have to arrive completely and in order.
+    std::vector<int> nextIndex(producers, 0);
+    int received = 0;
+    while (received < producers * commandsPerProducer) {
+        auto command = queue.pop();
+        if (!command) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto idCmd = static_cast<IdCmd*>(command.get());
+        ASSERT_EQ(idCmd->index, nextIndex[idCmd->producer]);
+        ++nextIndex[idCmd->producer];
+        ++received;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(nextIndex, std::vector<int>(producers, commandsPerProducer));
+}
+
+TEST(CommandQueueTest, ExecuterStress)
+{
+    constexpr int producers = 6;
+    constexpr int commandsPerProducer = 2000;
+
+    spix::CommandExecuter exec;
+    spix::MockScene scene;
+
+    // only accessed from this (the main) thread
+    std::vector<int> nextIndex(producers, 0);
+    bool inOrder = true;
+    std::atomic<bool> producersDone {false};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < commandsPerProducer; ++i) {
+                exec.enqueueCommand(std::make_unique<spix::cmd::CustomCmd>(
+                    [&, p, i](spix::CommandEnvironment&) {
+                        inOrder = inOrder && nextIndex[p] == i;
+                        ++nextIndex[p];
+                    },
+                    [] { return true; }));
+            }
+        });
+    }
+
+    std::thread joiner([&] {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        producersDone.store(true);
+    });
+
+    while (!producersDone.load() || exec.hasPendingCommands()) {
+        exec.processCommands(scene);
+    }
+    joiner.join();
+
+    // The commands of each thread have to be executed completely and in order
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(nextIndex, std::vector<int>(producers, commandsPerProducer));
+}
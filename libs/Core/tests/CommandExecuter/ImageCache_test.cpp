@@ -0,0 +1,50 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/CommandExecuter/ImageCache.h>
+
+namespace {
+
+std::shared_ptr<const spix::RgbaImage> Image(size_t bytes)
+{
+    return std::make_shared<spix::RgbaImage>(spix::RgbaImage {1, 1, std::string(bytes, '\0')});
+}
+
+} // namespace
+
+TEST(ImageCacheTest, FindInserted)
+{
+    spix::ImageCache cache(100);
+    EXPECT_EQ(cache.find("golden.png"), nullptr);
+
+    auto image = Image(10);
+    cache.insert("golden.png", image);
+    EXPECT_EQ(cache.find("golden.png"), image);
+    EXPECT_EQ(cache.find("other.png"), nullptr);
+
+    cache.clear();
+    EXPECT_EQ(cache.find("golden.png"), nullptr);
+}
+
+TEST(ImageCacheTest, DropsLeastRecentlyUsed)
+{
+    spix::ImageCache cache(100);
+    cache.insert("first.png", Image(40));
+    cache.insert("second.png", Image(40));
+    EXPECT_NE(cache.find("first.png"), nullptr);
+
+    cache.insert("third.png", Image(40));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_NE(cache.find("first.png"), nullptr);
+    EXPECT_EQ(cache.find("second.png"), nullptr);
+    EXPECT_NE(cache.find("third.png"), nullptr);
+
+    // an image larger than the limit replaces all others
+    cache.insert("large.png", Image(200));
+    EXPECT_EQ(cache.size(), 1);
+}
@@ -0,0 +1,51 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Scene/Mock/MockImage.h>
+#include <Spix/CommandExecuter/SharedImageStore.h>
+
+TEST(SharedImageStoreTest, Publish)
+{
+    spix::SharedImageStore store(4);
+
+    auto image = store.publish(spix::MockImage(2, 3));
+    EXPECT_FALSE(image.name.empty());
+    EXPECT_EQ(image.width, 2);
+    EXPECT_EQ(image.height, 3);
+    EXPECT_EQ(image.stride, 8);
+    EXPECT_EQ(image.format, "rgba8888");
+    EXPECT_EQ(image.size, 24);
+    EXPECT_EQ(store.size(), 1);
+
+    EXPECT_TRUE(store.publish(spix::MockImage(0, 0)).name.empty());
+    EXPECT_EQ(store.size(), 1);
+}
+
+TEST(SharedImageStoreTest, Release)
+{
+    spix::SharedImageStore store(4);
+    auto image = store.publish(spix::MockImage(1, 1));
+
+    EXPECT_FALSE(store.release("unknown"));
+    EXPECT_TRUE(store.release(image.name));
+    EXPECT_FALSE(store.release(image.name));
+    EXPECT_EQ(store.size(), 0);
+}
+
+TEST(SharedImageStoreTest, RemovesOldestImages)
+{
+    spix::SharedImageStore store(2);
+    auto first = store.publish(spix::MockImage(1, 1));
+    auto second = store.publish(spix::MockImage(1, 1));
+    auto third = store.publish(spix::MockImage(1, 1));
+
+    EXPECT_EQ(store.size(), 2);
+    EXPECT_FALSE(store.release(first.name));
+    EXPECT_TRUE(store.release(second.name));
+    EXPECT_TRUE(store.release(third.name));
+}
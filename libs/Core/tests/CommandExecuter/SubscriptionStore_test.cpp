@@ -0,0 +1,48 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/CommandExecuter/SubscriptionStore.h>
+
+TEST(SubscriptionStoreTest, AddFindRemove)
+{
+    spix::SubscriptionStore store(4);
+
+    auto id = store.add("window/item", {"text", "value"}, std::chrono::milliseconds(50));
+    EXPECT_GT(id, 0);
+    EXPECT_EQ(store.size(), 1);
+
+    auto subscription = store.find(id);
+    ASSERT_NE(subscription, nullptr);
+    EXPECT_EQ(subscription->path.string(), "window/item");
+    EXPECT_EQ(subscription->properties, (std::vector<std::string> {"text", "value"}));
+    EXPECT_EQ(subscription->minInterval, std::chrono::milliseconds(50));
+    EXPECT_FALSE(subscription->sent);
+
+    EXPECT_EQ(store.find(id + 1), nullptr);
+    EXPECT_FALSE(store.remove(id + 1));
+    EXPECT_TRUE(store.remove(id));
+    EXPECT_FALSE(store.remove(id));
+    EXPECT_EQ(store.size(), 0);
+
+    // ids are not reused
+    EXPECT_NE(store.add("window/item", {"text"}, std::chrono::milliseconds(0)), id);
+}
+
+TEST(SubscriptionStoreTest, RemovesOldestSubscriptions)
+{
+    spix::SubscriptionStore store(2);
+
+    auto first = store.add("window/a", {"text"}, std::chrono::milliseconds(0));
+    auto second = store.add("window/b", {"text"}, std::chrono::milliseconds(0));
+    auto third = store.add("window/c", {"text"}, std::chrono::milliseconds(0));
+
+    EXPECT_EQ(store.size(), 2);
+    EXPECT_EQ(store.find(first), nullptr);
+    EXPECT_NE(store.find(second), nullptr);
+    EXPECT_NE(store.find(third), nullptr);
+}
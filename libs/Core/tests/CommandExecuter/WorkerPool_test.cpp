@@ -0,0 +1,88 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include <Spix/CommandExecuter/WorkerPool.h>
+
+TEST(WorkerPoolTest, LimitsJobs)
+{
+    spix::WorkerPool pool(1, 2);
+    std::atomic<int> finishedJobs {0};
+    pool.setJobFinishedHandler([&finishedJobs] { ++finishedJobs; });
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    EXPECT_TRUE(pool.hasCapacity());
+    pool.post([released] { released.wait(); });
+    EXPECT_TRUE(pool.hasCapacity());
+    pool.post([released] { released.wait(); });
+    EXPECT_FALSE(pool.hasCapacity());
+
+    release.set_value();
+    while (finishedJobs < 2) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(pool.hasCapacity());
+}
+
+TEST(WorkerPoolTest, ReportsErrors)
+{
+    spix::WorkerPool pool(2, 4);
+    std::promise<void> done;
+    auto finished = done.get_future();
+
+    pool.post([&pool] { pool.reportError("first"); });
+    pool.post([&done] {
+        done.set_value();
+        throw std::runtime_error("second");
+    });
+    finished.wait();
+
+    // the exception is reported after the job returned
+    std::vector<std::string> errors;
+    while (errors.size() < 2) {
+        auto newErrors = pool.takeErrors();
+        errors.insert(errors.end(), newErrors.begin(), newErrors.end());
+    }
+    EXPECT_EQ(errors.size(), 2);
+    EXPECT_TRUE(pool.takeErrors().empty());
+}
+
+TEST(WorkerPoolTest, FinishesJobsOnDestruction)
+{
+    std::atomic<int> finishedJobs {0};
+    {
+        spix::WorkerPool pool(2, 8);
+        for (int i = 0; i < 8; ++i) {
+            pool.post([&finishedJobs] { ++finishedJobs; });
+        }
+    }
+    EXPECT_EQ(finishedJobs, 8);
+}
+
+TEST(WorkerPoolTest, ReservationsCountAgainstTheLimit)
+{
+    spix::WorkerPool pool(1, 2);
+    std::promise<void> done;
+    auto finished = done.get_future();
+
+    pool.reserve();
+    pool.reserve();
+    EXPECT_FALSE(pool.hasCapacity());
+
+    pool.cancelReservation();
+    EXPECT_TRUE(pool.hasCapacity());
+
+    pool.postReserved([&done] { done.set_value(); });
+    finished.wait();
+}
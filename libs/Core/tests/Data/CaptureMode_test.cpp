@@ -0,0 +1,30 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/Data/CaptureMode.h>
+
+#include <stdexcept>
+
+TEST(CaptureModeTest, FromString)
+{
+    EXPECT_EQ(spix::captureModeFromString("default"), spix::CaptureMode::Default);
+    EXPECT_EQ(spix::captureModeFromString("window"), spix::CaptureMode::Window);
+    EXPECT_EQ(spix::captureModeFromString("item"), spix::CaptureMode::Item);
+}
+
+TEST(CaptureModeTest, Name)
+{
+    EXPECT_EQ(spix::captureModeName(spix::CaptureMode::Window), "window");
+    EXPECT_EQ(spix::captureModeName(spix::captureModeFromString("item")), "item");
+}
+
+TEST(CaptureModeTest, InvalidStrings)
+{
+    EXPECT_THROW(spix::captureModeFromString("screen"), std::invalid_argument);
+    EXPECT_THROW(spix::captureModeFromString(""), std::invalid_argument);
+}
@@ -0,0 +1,50 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/Data/CompiledPath.h>
+
+#include <string>
+
+namespace {
+
+std::string Identity(const std::string& value)
+{
+    return value;
+}
+
+} // namespace
+
+TEST(CompiledPathTest, Compile)
+{
+    auto compiledPath = spix::path::CompilePath<std::string, std::string>(
+        "window/button/#Rectangle/\"OK\"/(role=accept)/.child", Identity, Identity);
+
+    ASSERT_EQ(compiledPath.size(), 6);
+    EXPECT_EQ(compiledPath[1].kind, spix::path::SelectorKind::Name);
+    EXPECT_EQ(compiledPath[1].value, "button");
+    EXPECT_EQ(compiledPath[2].kind, spix::path::SelectorKind::Type);
+    EXPECT_EQ(compiledPath[2].value, "Rectangle");
+    EXPECT_EQ(compiledPath[3].kind, spix::path::SelectorKind::Value);
+    EXPECT_EQ(compiledPath[3].value, "OK");
+    EXPECT_EQ(compiledPath[4].kind, spix::path::SelectorKind::PropertyValue);
+    EXPECT_EQ(compiledPath[4].property, "role");
+    EXPECT_EQ(compiledPath[4].value, "accept");
+    EXPECT_EQ(compiledPath[5].kind, spix::path::SelectorKind::Property);
+    EXPECT_EQ(compiledPath[5].property, "child");
+}
+
+TEST(CompiledPathTest, ConvertsValues)
+{
+    auto size = [](const std::string& value) { return value.size(); };
+    spix::path::Selector roleSelector = spix::path::PropertyValueSelector("role", "ok");
+    auto selector = spix::path::CompileSelector<size_t, size_t>(roleSelector, size, size);
+
+    EXPECT_EQ(selector.kind, spix::path::SelectorKind::PropertyValue);
+    EXPECT_EQ(selector.value, 2);
+    EXPECT_EQ(selector.property, 4);
+}
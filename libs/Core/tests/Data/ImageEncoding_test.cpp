@@ -0,0 +1,42 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/Data/ImageEncoding.h>
+
+#include <stdexcept>
+
+TEST(ImageEncodingTest, FromString)
+{
+    auto png = spix::ImageEncoding::fromString("png:1");
+    EXPECT_EQ(png.format(), spix::ImageEncoding::Format::Png);
+    EXPECT_EQ(png.level(), 1);
+
+    auto jpeg = spix::ImageEncoding::fromString("jpg:85");
+    EXPECT_EQ(jpeg.format(), spix::ImageEncoding::Format::Jpeg);
+    EXPECT_EQ(jpeg.level(), 85);
+
+    auto raw = spix::ImageEncoding::fromString("raw");
+    EXPECT_EQ(raw.format(), spix::ImageEncoding::Format::Raw);
+    EXPECT_EQ(raw.level(), spix::ImageEncoding::DefaultLevel);
+}
+
+TEST(ImageEncodingTest, ToString)
+{
+    EXPECT_EQ(spix::ImageEncoding().toString(), "png");
+    EXPECT_EQ(spix::ImageEncoding(spix::ImageEncoding::Format::WebP, 90).toString(), "webp:90");
+    EXPECT_EQ(spix::ImageEncoding::fromString("qoi").toString(), "qoi");
+}
+
+TEST(ImageEncodingTest, InvalidStrings)
+{
+    EXPECT_THROW(spix::ImageEncoding::fromString("gif"), std::invalid_argument);
+    EXPECT_THROW(spix::ImageEncoding::fromString("png:"), std::invalid_argument);
+    EXPECT_THROW(spix::ImageEncoding::fromString("png:fast"), std::invalid_argument);
+    EXPECT_THROW(spix::ImageEncoding::fromString("png:10"), std::invalid_argument);
+    EXPECT_THROW(spix::ImageEncoding::fromString("raw:1"), std::invalid_argument);
+}
@@ -0,0 +1,30 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Spix/Data/ImageHashAlgorithm.h>
+
+#include <stdexcept>
+
+TEST(ImageHashAlgorithmTest, FromString)
+{
+    EXPECT_EQ(spix::imageHashAlgorithmFromString("xxhash"), spix::ImageHashAlgorithm::XxHash);
+    EXPECT_EQ(spix::imageHashAlgorithmFromString("dhash"), spix::ImageHashAlgorithm::DHash);
+    EXPECT_EQ(spix::imageHashAlgorithmFromString("phash"), spix::ImageHashAlgorithm::PHash);
+}
+
+TEST(ImageHashAlgorithmTest, Name)
+{
+    EXPECT_EQ(spix::imageHashAlgorithmName(spix::ImageHashAlgorithm::XxHash), "xxhash");
+    EXPECT_EQ(spix::imageHashAlgorithmName(spix::imageHashAlgorithmFromString("phash")), "phash");
+}
+
+TEST(ImageHashAlgorithmTest, InvalidStrings)
+{
+    EXPECT_THROW(spix::imageHashAlgorithmFromString("md5"), std::invalid_argument);
+    EXPECT_THROW(spix::imageHashAlgorithmFromString(""), std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Scene/Mock/MockImage.h>
+#include <Spix/Scene/FrameRecorder.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+std::string ReadFile(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST(FrameRecorderTest, WritesFrames)
+{
+    const std::string filePath = "FrameRecorderTest.spixrec";
+    {
+        spix::FrameRecorder recorder(filePath, 10);
+        ASSERT_TRUE(recorder.isOpen());
+        EXPECT_EQ(recorder.frameInterval(), std::chrono::milliseconds(100));
+
+        recorder.addFrame(std::make_unique<spix::MockImage>(4, 2), std::chrono::microseconds(30));
+        recorder.addFrame(std::make_unique<spix::MockImage>(4, 2), std::chrono::microseconds(10));
+
+        auto statistics = recorder.finish();
+        EXPECT_EQ(statistics.frames, 2);
+        EXPECT_EQ(statistics.averageCaptureTime, std::chrono::microseconds(20));
+        EXPECT_EQ(statistics.maxCaptureTime, std::chrono::microseconds(30));
+        EXPECT_EQ(statistics.bytesWritten, static_cast<long long>(ReadFile(filePath).size()));
+    }
+
+    auto file = ReadFile(filePath);
+    std::remove(filePath.c_str());
+
+    const size_t fileHeaderSize = 12;
+    const size_t frameHeaderSize = 21;
+    ASSERT_GT(file.size(), fileHeaderSize + frameHeaderSize);
+    EXPECT_EQ(file.substr(0, 8), "SPIXREC1");
+    EXPECT_EQ(file[8], 10);
+
+    // first frame: white key frame of 4x2 pixels, encoded as a single run
+    auto frame = file.substr(fileHeaderSize);
+    EXPECT_EQ(frame[8], 4);
+    EXPECT_EQ(frame[12], 2);
+    EXPECT_EQ(frame[16], 0);
+    EXPECT_EQ(frame[17], 5);
+    EXPECT_EQ(frame.substr(frameHeaderSize, 5), std::string("\x11\xff\xff\xff\xff"));
+}
+
+TEST(FrameRecorderTest, DropsFramesIfBufferIsFull)
+{
+    const std::string filePath = "FrameRecorderTestDrop.spixrec";
+    spix::FrameRecorder recorder(filePath, 30, 1);
+
+    for (int i = 0; i < 50; ++i) {
+        recorder.addFrame(std::make_unique<spix::MockImage>(256, 256), std::chrono::microseconds(1));
+    }
+
+    auto statistics = recorder.finish();
+    EXPECT_EQ(statistics.frames + statistics.droppedFrames, 50);
+    EXPECT_GT(statistics.frames, 0);
+    std::remove(filePath.c_str());
+}
+
+TEST(FrameRecorderTest, CannotOpenFile)
+{
+    spix::FrameRecorder recorder("/nonexistent/directory/recording.spixrec", 10);
+    EXPECT_FALSE(recorder.isOpen());
+}
@@ -0,0 +1,134 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Scene/Mock/MockImage.h>
+#include <Spix/Scene/Image.h>
+
+namespace {
+
+// an item of 40x20 at a device pixel ratio of 2
+std::shared_ptr<spix::Image> ItemImage()
+{
+    return std::make_shared<spix::MockImage>(80, 40);
+}
+
+const spix::Size itemSize(40.0, 20.0);
+
+class CountingImage : public spix::MockImage {
+public:
+    using MockImage::MockImage;
+
+    std::unique_ptr<spix::Image> copy(int x, int y, int width, int height) const override
+    {
+        ++copies;
+        return MockImage::copy(x, y, width, height);
+    }
+
+    mutable int copies = 0;
+};
+
+} // namespace
+
+TEST(ImageTest, WithoutOptionsTheImageIsUnchanged)
+{
+    auto image = ItemImage();
+    EXPECT_EQ(spix::applyCaptureOptions(image, {}, itemSize), image);
+}
+
+TEST(ImageTest, RegionInItemCoordinates)
+{
+    spix::CaptureOptions options;
+    options.region = spix::Rect(10.0, 5.0, 15.0, 10.0);
+
+    auto image = spix::applyCaptureOptions(ItemImage(), options, itemSize);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width(), 30);
+    EXPECT_EQ(image->height(), 20);
+}
+
+TEST(ImageTest, RegionIsClippedToTheItem)
+{
+    spix::CaptureOptions options;
+    options.region = spix::Rect(30.0, -10.0, 100.0, 20.0);
+
+    auto image = spix::applyCaptureOptions(ItemImage(), options, itemSize);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width(), 20);
+    EXPECT_EQ(image->height(), 20);
+
+    options.region = spix::Rect(50.0, 0.0, 10.0, 10.0);
+    EXPECT_EQ(spix::applyCaptureOptions(ItemImage(), options, itemSize), nullptr);
+}
+
+TEST(ImageTest, MaxSizeKeepsAspectRatio)
+{
+    spix::CaptureOptions options;
+    options.maxWidth = 20;
+    options.maxHeight = 100;
+
+    auto image = spix::applyCaptureOptions(ItemImage(), options, itemSize);
+    EXPECT_EQ(image->width(), 20);
+    EXPECT_EQ(image->height(), 10);
+
+    options.maxWidth = 0;
+    options.maxHeight = 5;
+    image = spix::applyCaptureOptions(ItemImage(), options, itemSize);
+    EXPECT_EQ(image->width(), 10);
+    EXPECT_EQ(image->height(), 5);
+}
+
+TEST(ImageTest, ImagesAreNotEnlarged)
+{
+    spix::CaptureOptions options;
+    options.maxWidth = 1000;
+    options.maxHeight = 1000;
+
+    auto image = ItemImage();
+    EXPECT_EQ(spix::applyCaptureOptions(image, options, itemSize), image);
+}
+
+TEST(ImageTest, CroppedImageCopiesOnFirstRead)
+{
+    auto window = std::make_shared<CountingImage>(100, 100);
+    spix::CroppedImage image(window, 10, 20, 30, 40);
+
+    EXPECT_EQ(image.width(), 30);
+    EXPECT_EQ(image.height(), 40);
+    EXPECT_EQ(window->copies, 0);
+
+    EXPECT_EQ(image.rgbaPixels().size(), 30 * 40 * 4);
+    std::string data;
+    EXPECT_TRUE(image.encode(spix::ImageEncoding::fromString("png"), data));
+    EXPECT_EQ(window->copies, 1);
+
+    // Regions are copied from the source directly
+    auto region = image.copy(5, 5, 10, 10);
+    EXPECT_EQ(region->width(), 10);
+    EXPECT_EQ(window->copies, 2);
+}
+
+TEST(ImageTest, WriteRgbaPixelsWithStride)
+{
+    spix::MockImage image(2, 2, 0x11223344);
+    std::string pixels(2 * 12, '\0');
+    image.writeRgbaPixels(0, 0, 2, 2, &pixels[0], 12);
+
+    const std::string pixel("\x11\x22\x33\x44", 4);
+    EXPECT_EQ(pixels, pixel + pixel + std::string(4, '\0') + pixel + pixel + std::string(4, '\0'));
+}
+
+TEST(ImageTest, CroppedImageWritesWithoutCopying)
+{
+    auto window = std::make_shared<CountingImage>(100, 100);
+    spix::CroppedImage image(window, 10, 20, 3, 2);
+
+    std::string pixels(3 * 2 * 4, '\0');
+    image.writeRgbaPixels(0, 0, 3, 2, &pixels[0], 3 * 4);
+    EXPECT_EQ(pixels, std::string(3 * 2 * 4, '\xff'));
+    EXPECT_EQ(window->copies, 0);
+}
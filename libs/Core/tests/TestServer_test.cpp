@@ -0,0 +1,386 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Scene/Mock/MockScene.h>
+#include <Spix/CommandExecuter/CommandExecuter.h>
+#include <Spix/TestServer.h>
+
+#include <cstdio>
+#include <future>
+
+namespace {
+
+class NoopTestServer : public spix::TestServer {
+protected:
+    void executeTest() override {}
+};
+
+class TestServerTest : public testing::Test {
+protected:
+    TestServerTest() { server.setCommandExecuter(&exec); }
+
+    // Processes commands until `future` has its result, e.g. from a worker job
+    template <typename T>
+    void ProcessUntilReady(std::future<T>& future)
+    {
+        while (future.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready) {
+            exec.processCommands(scene);
+        }
+    }
+
+    template <typename T>
+    static bool IsReady(std::future<T>& future)
+    {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    spix::MockScene scene;
+    spix::CommandExecuter exec;
+    NoopTestServer server;
+};
+
+} // namespace
+
+TEST_F(TestServerTest, AsyncQueries)
+{
+    spix::MockItem item {spix::Size(100.0, 30.0)};
+    item.stringProperties()["text"] = "first";
+    scene.addItemAtPath(item, "window/first");
+    item.stringProperties()["text"] = "second";
+    scene.addItemAtPath(item, "window/second");
+
+    // Issue all queries before any of them is executed
+    auto first = server.getStringPropertyAsync("window/first", "text");
+    auto second = server.getStringPropertyAsync("window/second", "text");
+    auto bounds = server.getBoundingBoxAsync("window/second");
+    auto exists = server.existsAndVisibleAsync("window/third");
+    EXPECT_FALSE(IsReady(first));
+
+    exec.processCommands(scene);
+
+    EXPECT_EQ(first.get(), "first");
+    EXPECT_EQ(second.get(), "second");
+    EXPECT_EQ(bounds.get().size.width, 100.0);
+    EXPECT_FALSE(exists.get());
+}
+
+TEST_F(TestServerTest, StatisticsDefaultToEmpty)
+{
+    auto statistics = server.getStatisticsAsync();
+    exec.processCommands(scene);
+
+    EXPECT_TRUE(statistics.get().empty());
+}
+
+TEST_F(TestServerTest, GetProperties)
+{
+    spix::MockItem item {spix::Size(100.0, 30.0)};
+    item.stringProperties()["text"] = "first";
+    item.stringProperties()["color"] = "red";
+    scene.addItemAtPath(item, "window/first");
+    item.stringProperties()["text"] = "second";
+    scene.addItemAtPath(item, "window/second");
+
+    auto future = server.getPropertiesAsync({"window/first", "window/missing", "window/second"}, {"text", "color"});
+    exec.processCommands(scene);
+    auto values = future.get();
+
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_EQ(values[0]["text"], spix::Variant(std::string("first")));
+    EXPECT_EQ(values[0]["color"], spix::Variant(std::string("red")));
+    EXPECT_TRUE(values[1].empty());
+    EXPECT_EQ(values[2]["text"], spix::Variant(std::string("second")));
+    EXPECT_EQ(exec.state().errors().size(), 1);
+}
+
+TEST_F(TestServerTest, TakeScreenshotEncoded)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/item");
+
+    auto raw = server.takeScreenshotEncodedAsync("window/item", spix::ImageEncoding::fromString("raw"));
+    auto png = server.takeScreenshotEncodedAsync(
+        "window/item", spix::ImageEncoding::fromString("png:1"), spix::captureModeFromString("item"));
+    auto missing = server.takeScreenshotEncodedAsync("window/missing", spix::ImageEncoding());
+    auto jpeg = server.takeScreenshotEncodedAsync("window/item", spix::ImageEncoding::fromString("jpeg"));
+    auto saved = server.takeScreenshotAsync("window/item", "item.png");
+
+    // the images are encoded by workers, which allow only a few jobs at once
+    ProcessUntilReady(saved);
+    // errors of the workers are collected on the next call
+    exec.processCommands(scene);
+
+    auto rawImage = raw.get();
+    EXPECT_EQ(rawImage.width, 4);
+    EXPECT_EQ(rawImage.height, 2);
+    EXPECT_EQ(rawImage.data, std::string(4 * 2 * 4, '\xff'));
+
+    auto pngImage = png.get();
+    EXPECT_EQ(pngImage.encoding.toString(), "png:1");
+    EXPECT_EQ(pngImage.data, "png image");
+
+    EXPECT_TRUE(missing.get().data.empty());
+    EXPECT_EQ(jpeg.get().data, "jpeg image");
+    EXPECT_TRUE(saved.get());
+    EXPECT_EQ(exec.state().errors().size(), 1);
+}
+
+TEST_F(TestServerTest, TakeScreenshots)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/first");
+    scene.addItemAtPath(spix::MockItem {spix::Size(3.0, 3.0)}, "window/second");
+
+    auto images = server.takeScreenshotsAsync(
+        {"window/first", "window/missing", "window/second"}, spix::ImageEncoding::fromString("jpeg:80"));
+    ProcessUntilReady(images);
+
+    auto results = images.get();
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].width, 4);
+    EXPECT_EQ(results[0].data, "jpeg image");
+    EXPECT_TRUE(results[1].data.empty());
+    EXPECT_EQ(results[2].height, 3);
+    EXPECT_EQ(results[2].encoding.toString(), "jpeg:80");
+    EXPECT_EQ(exec.state().errors().size(), 1);
+}
+
+TEST_F(TestServerTest, CompareScreenshot)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/item");
+    scene.addImageFile(spix::MockImage(4, 2), "same.png");
+    scene.addImageFile(spix::MockImage(4, 2, 0xff0000ff), "red.png");
+    scene.addImageFile(spix::MockImage(2, 2), "small.png");
+
+    auto same = server.compareScreenshotAsync("window/item", "same.png", 0);
+    auto red = server.compareScreenshotAsync("window/item", "red.png", 0, true);
+    auto small = server.compareScreenshotAsync("window/item", "small.png", 0);
+    auto missing = server.compareScreenshotAsync("window/item", "missing.png", 0);
+    ProcessUntilReady(missing);
+    ProcessUntilReady(small);
+    // errors of the workers are collected on the next call
+    exec.processCommands(scene);
+
+    auto sameResult = same.get();
+    EXPECT_TRUE(sameResult.sizeMatches);
+    EXPECT_EQ(sameResult.mismatchedPixels, 0);
+
+    auto redResult = red.get();
+    EXPECT_EQ(redResult.mismatchPercent, 100.0);
+    EXPECT_EQ(redResult.changedRegion.size.width, 4.0);
+    EXPECT_FALSE(redResult.diffImage.empty());
+
+    EXPECT_FALSE(small.get().sizeMatches);
+    EXPECT_FALSE(missing.get().sizeMatches);
+    EXPECT_EQ(exec.state().errors().size(), 1);
+}
+
+TEST_F(TestServerTest, Recording)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window");
+
+    const std::string filePath = "TestServerTest.spixrec";
+    auto started = server.startRecordingAsync("window", 10, filePath);
+    auto startedTwice = server.startRecordingAsync("window", 10, filePath);
+    auto statistics = server.stopRecordingAsync();
+    auto stoppedTwice = server.stopRecordingAsync();
+    ProcessUntilReady(stoppedTwice);
+
+    EXPECT_TRUE(started.get());
+    EXPECT_FALSE(startedTwice.get());
+    EXPECT_EQ(statistics.get().frames, 1);
+    EXPECT_EQ(stoppedTwice.get().frames, 0);
+    EXPECT_EQ(exec.state().errors().size(), 2);
+    std::remove(filePath.c_str());
+}
+
+TEST_F(TestServerTest, WaitForStableFrame)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/item");
+
+    // the mock scene does not count frames, so every check is a new frame
+    auto stable = server.waitForStableFrameAsync("window/item", 3, std::chrono::seconds(10));
+    for (int i = 0; i < 2; ++i) {
+        exec.processCommands(scene);
+        EXPECT_FALSE(IsReady(stable));
+    }
+    exec.processCommands(scene);
+    EXPECT_TRUE(stable.get());
+
+    auto missing = server.waitForStableFrameAsync("window/missing", 3, std::chrono::milliseconds(0));
+    exec.processCommands(scene);
+    EXPECT_FALSE(missing.get());
+}
+
+TEST_F(TestServerTest, GetImageHash)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/item");
+
+    auto exact = server.getImageHashAsync("window/item", spix::ImageHashAlgorithm::XxHash);
+    auto perceptual = server.getImageHashAsync("window/item", spix::imageHashAlgorithmFromString("dhash"));
+    auto missing = server.getImageHashAsync("window/missing", spix::ImageHashAlgorithm::PHash);
+    ProcessUntilReady(perceptual);
+
+    EXPECT_NE(exact.get(), 0);
+    // a single color has no differences between neighbours
+    EXPECT_EQ(perceptual.get(), 0);
+    EXPECT_EQ(missing.get(), 0);
+    EXPECT_EQ(exec.state().errors().size(), 1);
+}
+
+TEST_F(TestServerTest, TakeScreenshotShared)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/item");
+
+    auto shared = server.takeScreenshotSharedAsync("window/item");
+    auto missing = server.takeScreenshotSharedAsync("window/missing");
+    ProcessUntilReady(missing);
+
+    auto image = shared.get();
+    EXPECT_FALSE(image.name.empty());
+    EXPECT_EQ(image.width, 4);
+    EXPECT_EQ(image.height, 2);
+    EXPECT_EQ(image.stride, 16);
+    EXPECT_EQ(image.size, 32);
+    EXPECT_TRUE(missing.get().name.empty());
+
+    server.releaseSharedScreenshot(image.name);
+    server.releaseSharedScreenshot(image.name);
+    exec.processCommands(scene);
+    EXPECT_EQ(exec.state().errors().size(), 2);
+}
+
+TEST_F(TestServerTest, TakeScreenshotsWithOptions)
+{
+    scene.addItemAtPath(spix::MockItem {spix::Size(40.0, 20.0)}, "window/item");
+
+    spix::CaptureOptions thumbnail;
+    thumbnail.maxWidth = 8;
+    spix::CaptureOptions region;
+    region.region = spix::Rect(0.0, 0.0, 10.0, 10.0);
+
+    auto raw = spix::ImageEncoding::fromString("raw");
+    auto small = server.takeScreenshotEncodedAsync("window/item", raw, spix::CaptureMode::Default, thumbnail);
+    auto many = server.takeScreenshotsAsync({"window/item", "window/item"}, raw, region);
+    ProcessUntilReady(many);
+
+    auto smallImage = small.get();
+    EXPECT_EQ(smallImage.width, 8);
+    EXPECT_EQ(smallImage.height, 4);
+    EXPECT_EQ(smallImage.data.size(), 8 * 4 * 4);
+
+    for (const auto& image : many.get()) {
+        EXPECT_EQ(image.width, 10);
+        EXPECT_EQ(image.height, 10);
+    }
+}
+
+TEST_F(TestServerTest, WaitForItemResolvesPathOnlyAfterChanges)
+{
+    auto found = server.waitForItemAsync("window/late", std::chrono::milliseconds(10000));
+    for (int i = 0; i < 10; ++i) {
+        exec.processCommands(scene);
+    }
+    EXPECT_EQ(scene.itemLookups(), 1);
+    EXPECT_FALSE(IsReady(found));
+
+    scene.addItemAtPath(spix::MockItem {spix::Size(4.0, 2.0)}, "window/late");
+    exec.processCommands(scene);
+    EXPECT_EQ(scene.itemLookups(), 2);
+    ASSERT_TRUE(IsReady(found));
+    EXPECT_TRUE(found.get());
+}
+
+TEST_F(TestServerTest, WaitForPropertyReadsOnlyAfterChanges)
+{
+    spix::MockItem item {spix::Size(4.0, 2.0)};
+    item.stringProperties()["text"] = "loading";
+    scene.addItemAtPath(std::move(item), "window/label");
+
+    auto matched = server.waitForPropertyAsync(
+        "window/label", "text", spix::Variant(std::string("done")), std::chrono::milliseconds(10000));
+    for (int i = 0; i < 10; ++i) {
+        exec.processCommands(scene);
+    }
+    EXPECT_EQ(scene.itemLookups(), 1);
+    EXPECT_FALSE(IsReady(matched));
+
+    scene.setItemProperty("window/label", "text", "done");
+    exec.processCommands(scene);
+    EXPECT_EQ(scene.itemLookups(), 2);
+    ASSERT_TRUE(IsReady(matched));
+    EXPECT_TRUE(matched.get());
+
+    auto timedOut = server.waitForPropertyAsync(
+        "window/label", "text", spix::Variant(std::string("loading")), std::chrono::milliseconds(0));
+    exec.processCommands(scene);
+    ASSERT_TRUE(IsReady(timedOut));
+    EXPECT_FALSE(timedOut.get());
+}
+
+TEST_F(TestServerTest, SubscribeToPropertyChanges)
+{
+    spix::MockItem item {spix::Size(4.0, 2.0)};
+    item.stringProperties()["text"] = "a";
+    item.stringProperties()["value"] = "1";
+    scene.addItemAtPath(std::move(item), "window/label");
+
+    auto subscribed = server.subscribeAsync("window/label", {"text", "value"}, std::chrono::milliseconds(0));
+    exec.processCommands(scene);
+    auto id = subscribed.get();
+
+    // The first call returns all properties
+    auto initial = server.waitForChangesAsync(id, std::chrono::milliseconds(10000));
+    exec.processCommands(scene);
+    ASSERT_TRUE(IsReady(initial));
+    EXPECT_EQ(initial.get().size(), 2);
+
+    // Later calls only read the properties after they changed
+    auto changed = server.waitForChangesAsync(id, std::chrono::milliseconds(10000));
+    auto lookups = scene.itemLookups();
+    for (int i = 0; i < 10; ++i) {
+        exec.processCommands(scene);
+    }
+    EXPECT_EQ(scene.itemLookups(), lookups);
+    EXPECT_FALSE(IsReady(changed));
+
+    scene.setItemProperty("window/label", "text", "b");
+    scene.setItemProperty("window/label", "text", "c");
+    exec.processCommands(scene);
+    ASSERT_TRUE(IsReady(changed));
+    auto changes = changed.get();
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(std::get<std::string>(changes["text"].base()), "c");
+
+    server.unsubscribe(id);
+    auto unsubscribed = server.waitForChangesAsync(id, std::chrono::milliseconds(10000));
+    exec.processCommands(scene);
+    ASSERT_TRUE(IsReady(unsubscribed));
+    EXPECT_TRUE(unsubscribed.get().empty());
+}
+
+TEST_F(TestServerTest, SubscriptionRateLimit)
+{
+    spix::MockItem item {spix::Size(4.0, 2.0)};
+    item.stringProperties()["text"] = "a";
+    scene.addItemAtPath(std::move(item), "window/label");
+
+    auto subscribed = server.subscribeAsync("window/label", {"text"}, std::chrono::milliseconds(10000));
+    exec.processCommands(scene);
+    auto id = subscribed.get();
+
+    auto initial = server.waitForChangesAsync(id, std::chrono::milliseconds(10000));
+    exec.processCommands(scene);
+    EXPECT_EQ(initial.get().size(), 1);
+
+    // Changes within the interval are held back until the next delivery,
+    // without polling in between
+    scene.setItemProperty("window/label", "text", "b");
+    auto limited = server.waitForChangesAsync(id, std::chrono::milliseconds(5000));
+    exec.processCommands(scene);
+    EXPECT_FALSE(IsReady(limited));
+    EXPECT_GT(exec.nextCheckDelay(std::chrono::milliseconds(10)), std::chrono::milliseconds(4000));
+}
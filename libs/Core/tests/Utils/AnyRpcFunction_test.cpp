@@ -8,6 +8,7 @@
 
 #include <Utils/AnyRpcFunction.h>
 #include <anyrpc/anyrpc.h>
+#include <future>
 
 TEST(AnyRpcFunctionTest, ThreeArgsNoReturn)
 {
@@ -176,3 +177,108 @@ TEST(AnyRpcFunctionTest, NoArgWithVecVarReturn)
     EXPECT_TRUE(result.IsString());
     EXPECT_EQ(result.GetString(), std::string("Hi there"));
 }
+
+TEST(AnyRpcFunctionTest, BatchCallsMethods)
+{
+    anyrpc::MethodManager manager;
+
+    std::vector<int> calledWith;
+
+    spix::utils::AddFunctionToAnyRpc<int(int)>(&manager, "add_one", "Help Text", [&](int a) {
+        calledWith.push_back(a);
+        return a + 1;
+    });
+    manager.AddMethod(new spix::utils::AnyRpcBatchFunction(
+        &manager, [](const std::function<void()>& calls) { calls(); }, "batch", "Help Text"));
+
+    // Construct list of calls
+    anyrpc::Value calls;
+    calls.SetArray();
+    for (int i = 0; i < 2; ++i) {
+        anyrpc::Value callParams;
+        callParams.SetArray();
+        callParams[0] = anyrpc::Value(i * 10);
+
+        anyrpc::Value method("add_one");
+        anyrpc::Value call;
+        call.SetMap();
+        call.AddMember("method", method);
+        call.AddMember("params", callParams);
+        calls.PushBack(call);
+    }
+    anyrpc::Value unknownMethod("no_such_method");
+    anyrpc::Value unknownCall;
+    unknownCall.SetMap();
+    unknownCall.AddMember("method", unknownMethod);
+    calls.PushBack(unknownCall);
+
+    anyrpc::Value args;
+    args.SetArray();
+    args[0] = calls;
+
+    // Call function
+    anyrpc::Value result;
+    manager.ExecuteMethod("batch", args, result);
+
+    // Check
+    EXPECT_EQ(calledWith, (std::vector<int> {0, 10}));
+    using Variant = spix::Variant;
+    auto results = std::get<Variant::ListType>(spix::utils::AnyRPCValueToVariant(result));
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(std::get<Variant::MapType>(results[0])["result"], Variant(1LL));
+    EXPECT_EQ(std::get<Variant::MapType>(results[1])["result"], Variant(11LL));
+    EXPECT_EQ(std::get<Variant::MapType>(results[2]).count("error"), 1);
+}
+
+TEST(AnyRpcFunctionTest, BatchIssuesAllCallsBeforeWaiting)
+{
+    anyrpc::MethodManager manager;
+
+    // The promises are only fulfilled after all calls were issued, as by
+    // a command group that is executed once it is complete.
+    std::vector<std::promise<int>> promises;
+    promises.reserve(2);
+
+    spix::utils::AddFunctionToAnyRpc<std::future<int>(int)>(&manager, "add_one_async", "Help Text", [&](int a) {
+        promises.emplace_back();
+        auto future = promises.back().get_future();
+        return std::async(
+            std::launch::deferred, [future = std::move(future), a]() mutable { return future.get() + a; });
+    });
+    auto runGroup = [&](const std::function<void()>& calls) {
+        calls();
+        for (auto& promise : promises) {
+            promise.set_value(1);
+        }
+    };
+    manager.AddMethod(new spix::utils::AnyRpcBatchFunction(&manager, runGroup, "batch", "Help Text"));
+
+    anyrpc::Value calls;
+    calls.SetArray();
+    for (int i = 0; i < 2; ++i) {
+        anyrpc::Value callParams;
+        callParams.SetArray();
+        callParams[0] = anyrpc::Value(i * 10);
+
+        anyrpc::Value method("add_one_async");
+        anyrpc::Value call;
+        call.SetMap();
+        call.AddMember("method", method);
+        call.AddMember("params", callParams);
+        calls.PushBack(call);
+    }
+
+    anyrpc::Value args;
+    args.SetArray();
+    args[0] = calls;
+
+    anyrpc::Value result;
+    manager.ExecuteMethod("batch", args, result);
+
+    EXPECT_EQ(promises.size(), 2);
+    using Variant = spix::Variant;
+    auto results = std::get<Variant::ListType>(spix::utils::AnyRPCValueToVariant(result));
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(std::get<Variant::MapType>(results[0])["result"], Variant(1LL));
+    EXPECT_EQ(std::get<Variant::MapType>(results[1])["result"], Variant(11LL));
+}
@@ -0,0 +1,23 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/Base64.h>
+
+TEST(Base64Test, Padding)
+{
+    EXPECT_EQ(spix::utils::EncodeBase64(""), "");
+    EXPECT_EQ(spix::utils::EncodeBase64("f"), "Zg==");
+    EXPECT_EQ(spix::utils::EncodeBase64("fo"), "Zm8=");
+    EXPECT_EQ(spix::utils::EncodeBase64("foo"), "Zm9v");
+    EXPECT_EQ(spix::utils::EncodeBase64("foobar"), "Zm9vYmFy");
+}
+
+TEST(Base64Test, BinaryData)
+{
+    EXPECT_EQ(spix::utils::EncodeBase64(std::string {'\0', '\xff', '\xfe'}), "AP/+");
+}
@@ -0,0 +1,87 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/ImageCompare.h>
+#include <Utils/QoiEncoder.h>
+
+namespace {
+
+spix::RgbaImage GrayImage(int width, int height, char gray)
+{
+    std::string pixel {gray, gray, gray, '\xff'};
+    spix::RgbaImage image {width, height, {}};
+    for (int i = 0; i < width * height; ++i) {
+        image.pixels += pixel;
+    }
+    return image;
+}
+
+void SetPixel(spix::RgbaImage& image, int x, int y, char red)
+{
+    image.pixels[(y * image.width + x) * 4] = red;
+}
+
+} // namespace
+
+TEST(ImageCompareTest, EqualImages)
+{
+    auto golden = GrayImage(8, 4, 100);
+    auto result = spix::utils::CompareImages(golden, golden, 0);
+
+    EXPECT_TRUE(result.sizeMatches);
+    EXPECT_EQ(result.mismatchedPixels, 0);
+    EXPECT_EQ(result.mismatchPercent, 0.0);
+    EXPECT_EQ(result.changedRegion.size.width, 0.0);
+    EXPECT_TRUE(result.diffImage.empty());
+}
+
+TEST(ImageCompareTest, ChangedRegion)
+{
+    auto golden = GrayImage(8, 4, 100);
+    auto actual = golden;
+    SetPixel(actual, 2, 1, 110);
+    SetPixel(actual, 5, 2, 103);
+    SetPixel(actual, 6, 3, 102);
+
+    auto result = spix::utils::CompareImages(actual, golden, 0);
+    EXPECT_EQ(result.mismatchedPixels, 3);
+    EXPECT_DOUBLE_EQ(result.mismatchPercent, 100.0 * 3 / 32);
+    EXPECT_EQ(result.changedRegion.topLeft.x, 2.0);
+    EXPECT_EQ(result.changedRegion.topLeft.y, 1.0);
+    EXPECT_EQ(result.changedRegion.size.width, 5.0);
+    EXPECT_EQ(result.changedRegion.size.height, 3.0);
+
+    // small differences are ignored with a tolerance
+    result = spix::utils::CompareImages(actual, golden, 2);
+    EXPECT_EQ(result.mismatchedPixels, 2);
+    EXPECT_EQ(result.changedRegion.size.width, 4.0);
+    EXPECT_EQ(result.changedRegion.size.height, 2.0);
+}
+
+TEST(ImageCompareTest, DifferentSizes)
+{
+    auto result = spix::utils::CompareImages(GrayImage(4, 4, 0), GrayImage(4, 5, 0), 255);
+
+    EXPECT_FALSE(result.sizeMatches);
+    EXPECT_EQ(result.mismatchedPixels, 16);
+    EXPECT_EQ(result.mismatchPercent, 100.0);
+    EXPECT_EQ(result.changedRegion.size.height, 4.0);
+}
+
+TEST(ImageCompareTest, DiffImage)
+{
+    auto golden = GrayImage(2, 1, 0);
+    auto actual = golden;
+    SetPixel(actual, 1, 0, 50);
+
+    auto result = spix::utils::CompareImages(actual, golden, 0, true);
+
+    // matching pixels are light gray, mismatches red
+    std::string diff {'\xbf', '\xbf', '\xbf', '\xff', '\xff', 0, 0, '\xff'};
+    EXPECT_EQ(result.diffImage, spix::utils::EncodeQoi(diff, 2, 1));
+}
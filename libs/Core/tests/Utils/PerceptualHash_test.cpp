@@ -0,0 +1,73 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/PerceptualHash.h>
+
+#include <bitset>
+#include <functional>
+
+namespace {
+
+std::string Image(int width, int height, std::function<int(int x, int y)> gray)
+{
+    std::string pixels;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            auto value = static_cast<char>(gray(x, y));
+            pixels += {value, value, value, '\xff'};
+        }
+    }
+    return pixels;
+}
+
+int Distance(uint64_t a, uint64_t b)
+{
+    return static_cast<int>(std::bitset<64>(a ^ b).count());
+}
+
+int Circle(int x, int y, int size)
+{
+    int dx = x - size / 2;
+    int dy = y - size / 3;
+    return dx * dx + dy * dy < size * size / 9 ? 220 : 40;
+}
+
+} // namespace
+
+TEST(PerceptualHashTest, DifferenceHashOfGradient)
+{
+    auto increasing = Image(90, 80, [](int x, int) { return x * 2; });
+    auto decreasing = Image(90, 80, [](int x, int) { return 200 - x * 2; });
+
+    EXPECT_EQ(spix::utils::DifferenceHash(increasing, 90, 80), ~0ULL);
+    EXPECT_EQ(spix::utils::DifferenceHash(decreasing, 90, 80), 0ULL);
+}
+
+TEST(PerceptualHashTest, SimilarImagesHaveSimilarHashes)
+{
+    auto circle = Image(128, 128, [](int x, int y) { return Circle(x, y, 128); });
+    auto brighterCircle = Image(128, 128, [](int x, int y) { return Circle(x, y, 128) + 20; });
+    auto smallCircle = Image(64, 64, [](int x, int y) { return Circle(x, y, 64); });
+    auto stripes = Image(128, 128, [](int x, int) { return (x / 16) % 2 ? 220 : 40; });
+
+    for (auto hash : {spix::utils::DifferenceHash, spix::utils::PerceptualHash}) {
+        auto circleHash = hash(circle, 128, 128);
+        EXPECT_LE(Distance(circleHash, hash(brighterCircle, 128, 128)), 2);
+        EXPECT_LE(Distance(circleHash, hash(smallCircle, 64, 64)), 6);
+        EXPECT_GE(Distance(circleHash, hash(stripes, 128, 128)), 16);
+    }
+}
+
+TEST(PerceptualHashTest, ImagesSmallerThanThumbnail)
+{
+    auto pixels = Image(2, 2, [](int x, int) { return x * 100; });
+
+    EXPECT_NO_THROW(spix::utils::PerceptualHash(pixels, 2, 2));
+    EXPECT_EQ(spix::utils::DifferenceHash(pixels, 2, 2), spix::utils::DifferenceHash(pixels, 2, 2));
+    EXPECT_THROW(spix::utils::DifferenceHash(pixels, 3, 2), std::invalid_argument);
+}
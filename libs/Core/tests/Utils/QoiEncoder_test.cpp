@@ -0,0 +1,64 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/QoiEncoder.h>
+
+namespace {
+
+std::string QoiFile(int width, int height, const std::string& chunks)
+{
+    std::string header {'q', 'o', 'i', 'f', 0, 0, 0, static_cast<char>(width), 0, 0, 0, static_cast<char>(height), 4, 0};
+    std::string end {0, 0, 0, 0, 0, 0, 0, 1};
+    return header + chunks + end;
+}
+
+} // namespace
+
+TEST(QoiEncoderTest, RunOfStartPixel)
+{
+    // Pixels equal to the implicit start pixel (opaque black) are encoded as run
+    std::string pixels {0, 0, 0, '\xff', 0, 0, 0, '\xff'};
+
+    EXPECT_EQ(spix::utils::EncodeQoi(pixels, 2, 1), QoiFile(2, 1, "\xc1"));
+}
+
+TEST(QoiEncoderTest, DiffLumaRgbAndIndex)
+{
+    std::string pixels {
+        1, 1, 1, '\xff', // small difference
+        9, 9, 9, '\xff', // luma difference
+        '\x80', 0, 0, '\xff', // new color
+        1, 1, 1, '\xff', // seen before
+        1, 1, 1, '\x7f', // new alpha
+    };
+
+    std::string chunks {
+        '\x7f', // diff
+        '\xa8', '\x88', // luma: dg 8, dr-dg 0, db-dg 0
+        '\xfe', '\x80', 0, 0, // rgb
+        4, // index of (1, 1, 1, 255)
+        '\xff', 1, 1, 1, '\x7f', // rgba
+    };
+
+    EXPECT_EQ(spix::utils::EncodeQoi(pixels, 5, 1), QoiFile(5, 1, chunks));
+}
+
+TEST(QoiEncoderTest, LongRunIsSplit)
+{
+    std::string pixels;
+    for (int i = 0; i < 64; ++i) {
+        pixels.append({0, 0, 0, '\xff'});
+    }
+
+    EXPECT_EQ(spix::utils::EncodeQoi(pixels, 8, 8), QoiFile(8, 8, "\xfd\xc1"));
+}
+
+TEST(QoiEncoderTest, SizeMismatch)
+{
+    EXPECT_THROW(spix::utils::EncodeQoi(std::string(7, 0), 2, 1), std::invalid_argument);
+}
@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/RleEncoder.h>
+
+namespace {
+
+const std::string red {'\xff', 0, 0, '\xff'};
+const std::string blue {0, 0, '\xff', '\xff'};
+const std::string zero(4, '\0');
+
+} // namespace
+
+TEST(RleEncoderTest, RunsAndLiterals)
+{
+    // 3 red pixels are a run, the 2 blue pixels are not worth one
+    auto pixels = red + red + red + blue + blue;
+
+    EXPECT_EQ(spix::utils::EncodeRle(pixels), "\x07" + red + "\x04" + blue + blue);
+}
+
+TEST(RleEncoderTest, LongRunUsesVarint)
+{
+    std::string pixels;
+    for (int i = 0; i < 100; ++i) {
+        pixels += blue;
+    }
+
+    // 100 << 1 | 1 = 201 = 0xc9 0x01
+    EXPECT_EQ(spix::utils::EncodeRle(pixels), "\xc9\x01" + blue);
+}
+
+TEST(RleEncoderTest, DeltaToPreviousFrame)
+{
+    auto previous = red + red + red + red;
+    auto current = red + red + blue + red;
+
+    auto changed = std::string {'\xff', 0, '\xff', 0};
+    EXPECT_EQ(spix::utils::EncodeRle(current, &previous), "\x08" + zero + zero + changed + zero);
+    EXPECT_EQ(spix::utils::EncodeRle(previous, &previous), "\x09" + zero);
+}
+
+TEST(RleEncoderTest, RejectsDifferentSizes)
+{
+    auto previous = red;
+    EXPECT_THROW(spix::utils::EncodeRle(red + red, &previous), std::invalid_argument);
+}
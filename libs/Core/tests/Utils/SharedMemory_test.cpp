@@ -0,0 +1,82 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/SharedMemory.h>
+
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Maps the segment a second time, like a client in another process would
+std::string ReadSegment(const std::string& name, size_t size)
+{
+    std::string data(size, '\0');
+#ifdef _WIN32
+    auto handle = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+    if (!handle) {
+        return {};
+    }
+    auto view = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, size);
+    std::memcpy(&data[0], view, size);
+    UnmapViewOfFile(view);
+    CloseHandle(handle);
+#else
+    int fd = shm_open(("/" + name).c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return {};
+    }
+    auto view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    std::memcpy(&data[0], view, size);
+    munmap(view, size);
+#endif
+    return data;
+}
+
+} // namespace
+
+TEST(SharedMemoryTest, OtherMappingsSeeTheData)
+{
+    auto memory = spix::utils::SharedMemory::create(6);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(memory->size(), 6);
+    std::memcpy(memory->data(), "pixels", 6);
+
+    EXPECT_EQ(ReadSegment(memory->name(), 6), "pixels");
+}
+
+TEST(SharedMemoryTest, NamesAreUnique)
+{
+    auto first = spix::utils::SharedMemory::create(1);
+    auto second = spix::utils::SharedMemory::create(1);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    EXPECT_NE(first->name(), second->name());
+    EXPECT_EQ(first->name().find('/'), std::string::npos);
+}
+
+TEST(SharedMemoryTest, RemovedOnDestruction)
+{
+    auto memory = spix::utils::SharedMemory::create(4);
+    ASSERT_NE(memory, nullptr);
+    auto name = memory->name();
+    memory.reset();
+
+    EXPECT_EQ(ReadSegment(name, 4), "");
+}
@@ -0,0 +1,41 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/VariantCompare.h>
+
+using spix::Variant;
+using spix::utils::VariantsEqual;
+
+TEST(VariantCompareTest, Numbers)
+{
+    EXPECT_TRUE(VariantsEqual(Variant(100LL), Variant(100.0)));
+    EXPECT_TRUE(VariantsEqual(Variant(100ULL), Variant(100LL)));
+    EXPECT_FALSE(VariantsEqual(Variant(100LL), Variant(100.5)));
+    EXPECT_FALSE(VariantsEqual(Variant(1LL), Variant(true)));
+}
+
+TEST(VariantCompareTest, SameTypeOnly)
+{
+    EXPECT_TRUE(VariantsEqual(Variant(nullptr), Variant(nullptr)));
+    EXPECT_TRUE(VariantsEqual(Variant(true), Variant(true)));
+    EXPECT_FALSE(VariantsEqual(Variant(true), Variant(false)));
+    EXPECT_TRUE(VariantsEqual(Variant(std::string("5")), Variant(std::string("5"))));
+    EXPECT_FALSE(VariantsEqual(Variant(std::string("5")), Variant(5LL)));
+}
+
+TEST(VariantCompareTest, ListsAndMaps)
+{
+    Variant list(Variant::ListType {1LL, std::string("a")});
+    EXPECT_TRUE(VariantsEqual(list, Variant(Variant::ListType {1.0, std::string("a")})));
+    EXPECT_FALSE(VariantsEqual(list, Variant(Variant::ListType {1LL})));
+
+    Variant map(Variant::MapType {{"x", 1LL}, {"y", 2LL}});
+    EXPECT_TRUE(VariantsEqual(map, Variant(Variant::MapType {{"x", 1LL}, {"y", 2.0}})));
+    EXPECT_FALSE(VariantsEqual(map, Variant(Variant::MapType {{"x", 1LL}, {"z", 2LL}})));
+    EXPECT_FALSE(VariantsEqual(map, Variant(Variant::MapType {{"x", 1LL}})));
+}
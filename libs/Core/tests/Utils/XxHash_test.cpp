@@ -0,0 +1,28 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <Utils/XxHash.h>
+
+TEST(XxHashTest, ReferenceValues)
+{
+    EXPECT_EQ(spix::utils::XxHash64(""), 0xef46db3751d8e999ULL);
+    EXPECT_EQ(spix::utils::XxHash64("a"), 0xd24ec4f1a98c6e5bULL);
+    EXPECT_EQ(spix::utils::XxHash64("abc"), 0x44bc2cf5ad770999ULL);
+}
+
+TEST(XxHashTest, LongInputAndSeed)
+{
+    // inputs of 32 bytes and more take the striped path
+    std::string data(100, 'x');
+    auto hash = spix::utils::XxHash64(data);
+
+    EXPECT_EQ(spix::utils::XxHash64(data.data(), data.size()), hash);
+    EXPECT_NE(spix::utils::XxHash64(data, 1), hash);
+    data[99] = 'y';
+    EXPECT_NE(spix::utils::XxHash64(data), hash);
+}
@@ -0,0 +1,108 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Measures the round trip time of a command from the TestServer
+ * thread to the GUI thread and back.
+ *
+ * The event driven QtQmlBot is compared to processing the command
+ * queue from a fixed 10ms timer, which is how the bot used to work.
+ *
+ * On headless machines, run with `QT_QPA_PLATFORM=offscreen`.
+ */
+
+#include <QGuiApplication>
+#include <QTimer>
+#include <QtScene.h>
+#include <Spix/CommandExecuter/CommandExecuter.h>
+#include <Spix/QtQmlBot.h>
+#include <Spix/TestServer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int iterations = 500;
+
+class LatencyServer : public spix::TestServer {
+public:
+    explicit LatencyServer(std::string name)
+    : m_name(std::move(name))
+    {
+    }
+
+protected:
+    void executeTest() override
+    {
+        std::vector<double> latencies;
+        latencies.reserve(iterations);
+
+        for (int i = 0; i < iterations; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            existsAndVisible("noSuchWindow");
+            std::chrono::duration<double, std::micro> latency = std::chrono::steady_clock::now() - start;
+            latencies.push_back(latency.count());
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        double total = 0.0;
+        for (auto latency : latencies) {
+            total += latency;
+        }
+
+        std::cout << m_name << ": " << iterations << " round trips in " << total / 1000.0 << "ms"
+                  << " | mean " << total / iterations << "us"
+                  << " | median " << latencies[iterations / 2] << "us"
+                  << " | p99 " << latencies[iterations * 99 / 100] << "us" << std::endl;
+
+        quit();
+    }
+
+private:
+    std::string m_name;
+};
+
+void RunEventDriven(QGuiApplication& app)
+{
+    spix::QtQmlBot bot;
+    LatencyServer server("event driven");
+    bot.runTestServer(server);
+    app.exec();
+}
+
+void RunFixedTimer(QGuiApplication& app)
+{
+    spix::CommandExecuter exec;
+    spix::QtScene scene;
+
+    QTimer timer;
+    QObject::connect(&timer, &QTimer::timeout, [&] { exec.processCommands(scene); });
+    timer.start(10);
+
+    LatencyServer server("fixed 10ms timer");
+    server.setCommandExecuter(&exec);
+    server.start();
+    app.exec();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    RunEventDriven(app);
+    RunFixedTimer(app);
+
+    return 0;
+}
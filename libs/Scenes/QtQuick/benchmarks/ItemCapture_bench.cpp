@@ -0,0 +1,145 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Compares capturing items by cropping them from a read back of the
+ * full window to rendering only the item with `grabToImage`, for items
+ * from icon size up to the full window.
+ *
+ * The time of a capture includes waiting for the frame that renders
+ * the item, so the item mode is measured from the request until the
+ * image arrives.
+ *
+ * On headless machines, run with `QT_QPA_PLATFORM=offscreen`.
+ */
+
+#include <QtScene.h>
+
+#include <QEventLoop>
+#include <QGuiApplication>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int iterations = 20;
+
+const char* sceneQml = R"(
+import QtQuick 2.15
+import QtQuick.Window 2.15
+
+Window {
+    objectName: "window"
+    width: 1920
+    height: 1080
+    visible: true
+    color: "#f5f5f5"
+
+    Rectangle {
+        objectName: "content"
+        anchors.fill: parent
+        anchors.margins: 40
+        gradient: Gradient {
+            GradientStop { position: 0.0; color: "#4670b4" }
+            GradientStop { position: 1.0; color: "#28468c" }
+        }
+
+        Rectangle {
+            objectName: "panel"
+            x: 100; y: 100; width: 512; height: 384
+            radius: 8
+            color: "#e1e4e8"
+            Text { anchors.centerIn: parent; text: "The quick brown fox jumps over the lazy dog" }
+        }
+
+        Rectangle {
+            objectName: "icon"
+            x: 700; y: 100; width: 32; height: 32
+            radius: 16
+            color: "#3c8c5a"
+        }
+    }
+}
+)";
+
+struct CaptureResult {
+    double milliseconds = 0.0;
+    int width = 0;
+    int height = 0;
+};
+
+CaptureResult MeasureCapture(spix::QtScene& scene, const std::string& path, spix::CaptureMode mode)
+{
+    CaptureResult result;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        QEventLoop loop;
+        bool done = false;
+        scene.grabImageAsync(path, mode, [&](std::unique_ptr<spix::Image> image) {
+            if (image) {
+                result.width = image->width();
+                result.height = image->height();
+            }
+            done = true;
+            loop.quit();
+        });
+        if (!done) {
+            loop.exec();
+        }
+    }
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    result.milliseconds = duration.count() / iterations;
+    return result;
+}
+
+void CompareModes(spix::QtScene& scene, const std::string& path)
+{
+    std::cout << path << std::endl;
+    for (auto mode : {spix::CaptureMode::Window, spix::CaptureMode::Item}) {
+        auto result = MeasureCapture(scene, path, mode);
+        std::cout << "  " << spix::captureModeName(mode) << ": " << result.milliseconds << "ms | " << result.width
+                  << "x" << result.height << " | " << result.width * result.height * 4 / 1024 << "KiB" << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(sceneQml, QUrl());
+    std::unique_ptr<QObject> window(component.create());
+    if (!window) {
+        std::cerr << component.errorString().toStdString() << std::endl;
+        return 1;
+    }
+
+    // let the window render its first frame
+    QEventLoop loop;
+    QObject::connect(qobject_cast<QQuickWindow*>(window.get()), &QQuickWindow::frameSwapped, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    spix::QtScene scene;
+    for (const auto& path : {"window/icon", "window/panel", "window/content"}) {
+        CompareModes(scene, path);
+    }
+
+    return 0;
+}
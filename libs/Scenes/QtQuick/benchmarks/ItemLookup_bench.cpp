@@ -0,0 +1,110 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Compares resolving item paths with a depth first search of the item
+ * tree to resolving them through the name and type index, on a generated
+ * scene of about 50k items.
+ *
+ * On headless machines, run with `QT_QPA_PLATFORM=offscreen`.
+ */
+
+#include <FindQtItem.h>
+#include <QtItemIndex.h>
+
+#include <QGuiApplication>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+constexpr int iterations = 200;
+
+const char* sceneQml = R"(
+import QtQuick 2.15
+
+Item {
+    Repeater {
+        model: 50
+        Item {
+            objectName: "group" + index
+            Repeater {
+                model: 1000
+                Item { objectName: "item" + index }
+            }
+        }
+    }
+    Rectangle { objectName: "last" }
+}
+)";
+
+double MeanMicroseconds(const std::function<QQuickItem*()>& lookup, bool& found)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        found = lookup() != nullptr;
+    }
+    std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / iterations;
+}
+
+void CompareLookups(const spix::qt::QtItemIndex& index, const std::string& path)
+{
+    spix::ItemPath itemPath(path);
+    bool foundBySearch = false;
+    bool foundByIndex = false;
+
+    auto search = MeanMicroseconds([&] { return spix::qt::GetQQuickItemAtPath(itemPath); }, foundBySearch);
+    auto indexed = MeanMicroseconds([&] { return index.findItem(itemPath); }, foundByIndex);
+
+    std::cout << path << ": search " << search << "us" << (foundBySearch ? "" : " (not found)") << " | index "
+              << indexed << "us" << (foundByIndex ? "" : " (not found)") << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    QQuickWindow window;
+    window.setObjectName("window");
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QByteArray(sceneQml), QUrl());
+    std::unique_ptr<QQuickItem> scene(qobject_cast<QQuickItem*>(component.create()));
+    if (!scene) {
+        std::cerr << component.errorString().toStdString() << std::endl;
+        return 1;
+    }
+    scene->setParentItem(window.contentItem());
+    window.show();
+
+    auto start = std::chrono::steady_clock::now();
+    spix::qt::QtItemIndex index(window.contentItem());
+    std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - start;
+    std::cout << "index of " << index.size() << " items built in " << buildTime.count() << "ms" << std::endl;
+
+    CompareLookups(index, "window/group0/item0");
+    CompareLookups(index, "window/group25/item500");
+    CompareLookups(index, "window/group49/item999");
+    CompareLookups(index, "window/#Rectangle");
+    CompareLookups(index, "window/group49/noSuchItem");
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+/**
+ * Compares the encode time and payload size of the screenshot
+ * encodings on window sized images.
+ *
+ * The images are painted to look like a typical UI: flat panels,
+ * a gradient, some lines and a lot of text.
+ *
+ * On headless machines, run with `QT_QPA_PLATFORM=offscreen`.
+ */
+
+#include <QtImage.h>
+
+#include <QGuiApplication>
+#include <QImage>
+#include <QLinearGradient>
+#include <QPainter>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int iterations = 5;
+
+QImage PaintWindow(int width, int height)
+{
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    image.fill(QColor(245, 245, 245));
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // toolbar with a gradient
+    QLinearGradient gradient(0, 0, 0, height / 12);
+    gradient.setColorAt(0, QColor(70, 110, 180));
+    gradient.setColorAt(1, QColor(40, 70, 140));
+    painter.fillRect(0, 0, width, height / 12, gradient);
+
+    // side panel with list entries
+    painter.fillRect(0, height / 12, width / 5, height, QColor(225, 228, 232));
+    QFont font = painter.font();
+    font.setPixelSize(height / 60);
+    painter.setFont(font);
+    const int lineHeight = height / 30;
+    for (int y = height / 12 + lineHeight, row = 0; y < height; y += lineHeight, ++row) {
+        painter.setPen(QColor(30, 30, 30));
+        painter.drawText(lineHeight / 2, y, QString("Entry %1 with some text").arg(row));
+        painter.setPen(QColor(200, 200, 200));
+        painter.drawLine(0, y + lineHeight / 3, width / 5, y + lineHeight / 3);
+    }
+
+    // content with text paragraphs and rounded buttons
+    painter.setPen(QColor(20, 20, 20));
+    for (int y = height / 12 + lineHeight * 2; y < height - lineHeight * 4; y += lineHeight) {
+        painter.drawText(width / 5 + lineHeight, y,
+            "The quick brown fox jumps over the lazy dog. Spix screenshots need to be encoded fast.");
+    }
+    for (int x = width / 5 + lineHeight; x < width - lineHeight * 6; x += lineHeight * 7) {
+        painter.setBrush(QColor(60, 140, 90));
+        painter.drawRoundedRect(x, height - lineHeight * 3, lineHeight * 6, lineHeight * 2, 8, 8);
+    }
+
+    return image;
+}
+
+void RunEncoding(const spix::QtImage& image, const std::string& encodingName)
+{
+    auto encoding = spix::ImageEncoding::fromString(encodingName);
+
+    spix::EncodedImage result;
+    std::chrono::microseconds totalTime {0};
+    for (int i = 0; i < iterations; ++i) {
+        if (!spix::encodeImage(image, encoding, result)) {
+            std::cout << "  " << encodingName << ": not supported" << std::endl;
+            return;
+        }
+        totalTime += result.encodeTime;
+    }
+
+    std::cout << "  " << encodingName << ": " << totalTime.count() / iterations / 1000.0 << "ms | "
+              << result.data.size() / 1024 << "KiB" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    const std::vector<QSize> sizes {{1280, 720}, {1920, 1080}, {3840, 2160}};
+    const std::vector<std::string> encodings {
+        "raw", "qoi", "png:0", "png:1", "png", "png:9", "jpeg:90", "jpeg:60", "webp:90", "webp:100"};
+
+    for (const auto& size : sizes) {
+        std::cout << size.width() << "x" << size.height() << std::endl;
+        spix::QtImage image(PaintWindow(size.width(), size.height()));
+        for (const auto& encoding : encodings) {
+            RunEncoding(image, encoding);
+        }
+    }
+
+    return 0;
+}
@@ -8,6 +8,7 @@
 
 #include <QObject>
 #include <Spix/TestServer.h>
+#include <chrono>
 #include <memory>
 
 #include <Spix/spix_qtquick_export.h>
@@ -21,7 +22,7 @@ class QtScene;
  * @brief Class that maintains and runs the test environment
  *
  * This QObject creates the test environment and hooks up
- * to the qt timer to get a callback on the main thread and
+ * to the Qt event loop to get a callback on the main thread and
  * process test commands.
  *
  * Usually it is enough to create one object of this type
@@ -36,10 +37,37 @@ public:
 
     void runTestServer(TestServer& server);
 
+    /**
+     * @brief Interval in which waiting commands are checked again
+     *
+     * Commands are processed as soon as they are enqueued. Commands that
+     * have to wait for a condition (e.g. `waitForStableFrame`) are polled
+     * in this interval until they can be executed. Defaults to 10ms.
+     *
+     * `wait` fires right at its deadline. `waitForItem` and `waitForProperty`
+     * are checked right after the item tree or the property changed, and
+     * at their timeout.
+     */
+    void setPollingInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Resolve item paths through an index of item names and types
+     *
+     * Speeds up item lookups in scenes with many items. The index is kept
+     * up to date with every change of the item tree, which adds some
+     * overhead to the application itself. Disabled by default.
+     */
+    void setItemIndexEnabled(bool enabled);
+
 protected:
     void timerEvent(QTimerEvent* event) override;
 
 private:
+    void processCommands();
+
+    int m_pollingTimerId = 0;
+    bool m_changePending = false;
+    std::chrono::milliseconds m_pollingInterval {10};
     std::unique_ptr<QtScene> m_scene;
     std::unique_ptr<CommandExecuter> m_cmdExec;
 };
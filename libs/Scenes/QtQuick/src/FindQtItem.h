@@ -6,14 +6,27 @@
 
 #pragma once
 
+#include <Spix/Data/CompiledPath.h>
 #include <Spix/Data/ItemPath.h>
+#include <Spix/Data/ItemPathComponent.h>
 
+#include <QByteArray>
 #include <QQuickItem>
 #include <QQuickWindow>
+#include <QString>
 
 namespace spix {
 namespace qt {
 
+/**
+ * A path selector with its values converted to Qt types
+ */
+using CompiledSelector = spix::path::BasicCompiledSelector<QString, QByteArray>;
+using CompiledPath = spix::path::BasicCompiledPath<QString, QByteArray>;
+
+CompiledSelector CompileSelector(const spix::path::Selector& selector);
+CompiledPath CompilePath(const spix::ItemPath& path);
+
 /**
  * Find a QQuickItem at the specified item path
  * @param path The item path to search for
@@ -30,5 +43,13 @@ QQuickItem* GetQQuickItemAtPath(const spix::ItemPath& path);
  */
 QQuickWindow* GetQQuickWindowAtPath(const spix::ItemPath& path);
 
+/**
+ * Check if an object itself matches a selector
+ * @param object The object to check
+ * @param selector The selector to match against
+ * @return true if the selector matches the object, false otherwise
+ */
+bool ObjectMatchesSelector(QObject* object, const CompiledSelector& selector);
+
 } // namespace qt
 } // namespace spix
@@ -10,6 +10,8 @@
 #include <QQuickItem>
 #include <QQuickWindow>
 
+#include <stdexcept>
+
 #include <QtItemTools.h>
 
 namespace spix {
@@ -53,6 +55,16 @@ std::string QtItem::stringProperty(const std::string& name) const
     return value.toString().toStdString();
 }
 
+Variant QtItem::property(const std::string& name) const
+{
+    try {
+        return qt::QVariantToVariant(qobject()->property(name.c_str()));
+    } catch (const std::runtime_error&) {
+        // e.g. QRectF or QObject* values
+        return Variant(nullptr);
+    }
+}
+
 void QtItem::setStringProperty(const std::string& name, const std::string& value)
 {
     qobject()->setProperty(name.c_str(), value.c_str());
@@ -25,6 +25,7 @@ public:
     Point position() const override;
     Rect bounds() const override;
     std::string stringProperty(const std::string& name) const override;
+    Variant property(const std::string& name) const override;
     void setStringProperty(const std::string& name, const std::string& value) override;
     bool invokeMethod(const std::string& method, const std::vector<Variant>& args, Variant& ret) override;
     bool visible() const override;
@@ -0,0 +1,131 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtItemCache.h"
+#include "FindQtItem.h"
+
+namespace spix {
+namespace qt {
+
+QtItemCache::~QtItemCache()
+{
+    clear();
+}
+
+QQuickItem* QtItemCache::lookup(const ItemPath& path, QQuickWindow* window, const Resolver& resolve)
+{
+    if (!isCacheable(path)) {
+        return resolve();
+    }
+
+    auto key = path.string();
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        if (isValid(it->second, path, window)) {
+            ++m_hits;
+            return it->second.item;
+        }
+        invalidate(key);
+    }
+
+    ++m_misses;
+    auto item = resolve();
+    if (item) {
+        insert(key, window, item);
+    }
+
+    return item;
+}
+
+void QtItemCache::clear()
+{
+    for (auto& keyAndEntry : m_entries) {
+        disconnect(keyAndEntry.second);
+    }
+    m_entries.clear();
+}
+
+Variant::MapType QtItemCache::statistics() const
+{
+    return {
+        {"itemCache.hits", m_hits},
+        {"itemCache.misses", m_misses},
+        {"itemCache.invalidations", m_invalidations},
+        {"itemCache.size", static_cast<long long>(m_entries.size())},
+    };
+}
+
+bool QtItemCache::isCacheable(const ItemPath& path)
+{
+    const auto& components = path.components();
+    for (size_t i = 1; i < components.size(); ++i) {
+        const auto& selector = components[i].selector();
+        if (!std::holds_alternative<path::NameSelector>(selector)
+            && !std::holds_alternative<path::TypeSelector>(selector)) {
+            return false;
+        }
+    }
+
+    return components.size() > 1;
+}
+
+bool QtItemCache::isValid(const Entry& entry, const ItemPath& path, QQuickWindow* window) const
+{
+    if (!entry.item || entry.window != window || entry.item->window() != window) {
+        return false;
+    }
+
+    return ObjectMatchesSelector(entry.item, CompileSelector(path.components().back().selector()));
+}
+
+void QtItemCache::insert(const std::string& key, QQuickWindow* window, QQuickItem* item)
+{
+    Entry entry;
+    entry.window = window;
+    entry.item = item;
+
+    auto onChange = [this, key] { invalidate(key); };
+
+    // Any change around the item or its ancestors might make another item match the path first
+    QObject* node = item;
+    while (node && node != window) {
+        entry.connections.push_back(QObject::connect(node, &QObject::objectNameChanged, onChange));
+        entry.connections.push_back(QObject::connect(node, &QObject::destroyed, onChange));
+
+        auto quickItem = qobject_cast<QQuickItem*>(node);
+        if (quickItem) {
+            entry.connections.push_back(QObject::connect(quickItem, &QQuickItem::parentChanged, onChange));
+            entry.connections.push_back(QObject::connect(quickItem, &QQuickItem::childrenChanged, onChange));
+        }
+
+        node = (quickItem && quickItem->parentItem()) ? quickItem->parentItem() : node->parent();
+    }
+
+    m_entries[key] = std::move(entry);
+}
+
+void QtItemCache::invalidate(const std::string& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return;
+    }
+
+    ++m_invalidations;
+    disconnect(it->second);
+    m_entries.erase(it);
+}
+
+void QtItemCache::disconnect(Entry& entry)
+{
+    for (const auto& connection : entry.connections) {
+        QObject::disconnect(connection);
+    }
+    entry.connections.clear();
+}
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,75 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Data/ItemPath.h>
+#include <Spix/Data/Variant.h>
+
+#include <QMetaObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QQuickWindow>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Caches the results of item path lookups
+ *
+ * Only paths made of name and type selectors are cached, as they depend on
+ * the structure of the item tree alone. An entry is dropped as soon as one
+ * of the cached item's ancestors changes its children, its parent or its
+ * name. On every hit, the entry is checked again to be alive, to be shown
+ * in the same window and to match the last selector of the path.
+ */
+class QtItemCache {
+public:
+    using Resolver = std::function<QQuickItem*()>;
+
+    QtItemCache() = default;
+    QtItemCache(const QtItemCache&) = delete;
+    QtItemCache& operator=(const QtItemCache&) = delete;
+    ~QtItemCache();
+
+    /**
+     * @brief Return the cached item for the path or resolve it on a miss
+     * @param path The path to look up, including the window component
+     * @param window The window the path was resolved to
+     * @param resolve Resolves the path if it is not in the cache
+     */
+    QQuickItem* lookup(const ItemPath& path, QQuickWindow* window, const Resolver& resolve);
+
+    void clear();
+
+    Variant::MapType statistics() const;
+
+private:
+    struct Entry {
+        QPointer<QQuickWindow> window;
+        QPointer<QQuickItem> item;
+        std::vector<QMetaObject::Connection> connections;
+    };
+
+    static bool isCacheable(const ItemPath& path);
+    bool isValid(const Entry& entry, const ItemPath& path, QQuickWindow* window) const;
+    void insert(const std::string& key, QQuickWindow* window, QQuickItem* item);
+    void invalidate(const std::string& key);
+    static void disconnect(Entry& entry);
+
+    std::unordered_map<std::string, Entry> m_entries;
+    long long m_hits = 0;
+    long long m_misses = 0;
+    long long m_invalidations = 0;
+};
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,242 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtItemIndex.h"
+
+#include <QtItemTools.h>
+
+#include <algorithm>
+
+namespace {
+
+int Depth(QQuickItem* item)
+{
+    int depth = 0;
+    for (; item->parentItem(); item = item->parentItem()) {
+        ++depth;
+    }
+    return depth;
+}
+
+QQuickItem* AncestorAtDepth(QQuickItem* item, int depth, int targetDepth)
+{
+    for (; depth > targetDepth; --depth) {
+        item = item->parentItem();
+    }
+    return item;
+}
+
+} // namespace
+
+namespace spix {
+namespace qt {
+
+QtItemIndex::QtItemIndex(QQuickItem* root)
+: m_root(root)
+{
+    add(root);
+}
+
+QtItemIndex::~QtItemIndex()
+{
+    for (auto& node : m_nodes) {
+        for (const auto& connection : node.connections) {
+            QObject::disconnect(connection);
+        }
+    }
+}
+
+QQuickItem* QtItemIndex::findItem(const ItemPath& path) const
+{
+    if (!m_root || path.length() < 2) {
+        return nullptr;
+    }
+
+    auto compiledPath = CompilePath(path);
+    for (size_t i = 1; i < compiledPath.size(); ++i) {
+        auto kind = compiledPath[i].kind;
+        if (kind != CompiledSelector::Kind::Name && kind != CompiledSelector::Kind::Type) {
+            return nullptr;
+        }
+    }
+
+    const auto& lastSelector = compiledPath.back();
+    const auto& itemsByKey = lastSelector.kind == CompiledSelector::Kind::Name ? m_itemsByName : m_itemsByType;
+    auto candidates = itemsByKey.constFind(lastSelector.value);
+    if (candidates == itemsByKey.constEnd()) {
+        return nullptr;
+    }
+
+    QQuickItem* result = nullptr;
+    int resultDepth = 0;
+    for (auto item : *candidates) {
+        if (!ObjectMatchesSelector(item, lastSelector) || !matchesAncestors(item, compiledPath)) {
+            continue;
+        }
+        auto depth = Depth(item);
+        if (!result || isBeforeInTree(item, depth, result, resultDepth)) {
+            result = item;
+            resultDepth = depth;
+        }
+    }
+
+    return result;
+}
+
+void QtItemIndex::add(QQuickItem* item)
+{
+    if (!item || m_nodes.contains(item)) {
+        return;
+    }
+
+    Node node;
+    node.name = GetObjectName(item);
+    node.type = TypeStringForObject(item);
+    node.connections.push_back(
+        QObject::connect(item, &QQuickItem::childrenChanged, [this, item] { onChildrenChanged(item); }));
+    node.connections.push_back(
+        QObject::connect(item, &QObject::objectNameChanged, [this, item] { onNameChanged(item); }));
+    node.connections.push_back(QObject::connect(item, &QObject::destroyed, [this, item] { removeNode(item); }));
+    if (item != m_root) {
+        node.connections.push_back(
+            QObject::connect(item, &QQuickItem::parentChanged, [this, item] { onParentChanged(item); }));
+    }
+
+    if (!node.name.isEmpty()) {
+        m_itemsByName[node.name].insert(item);
+    }
+    m_itemsByType[node.type].insert(item);
+    m_nodes.insert(item, std::move(node));
+
+    for (auto child : item->childItems()) {
+        add(child);
+    }
+}
+
+void QtItemIndex::remove(QQuickItem* item)
+{
+    if (!m_nodes.contains(item)) {
+        return;
+    }
+
+    for (auto child : item->childItems()) {
+        remove(child);
+    }
+    removeNode(item);
+}
+
+void QtItemIndex::removeNode(QQuickItem* item)
+{
+    auto node = m_nodes.find(item);
+    if (node == m_nodes.end()) {
+        return;
+    }
+
+    for (const auto& connection : node->connections) {
+        QObject::disconnect(connection);
+    }
+
+    auto removeFrom = [item](QHash<QString, QSet<QQuickItem*>>& itemsByKey, const QString& key) {
+        auto items = itemsByKey.find(key);
+        if (items != itemsByKey.end()) {
+            items->remove(item);
+            if (items->isEmpty()) {
+                itemsByKey.erase(items);
+            }
+        }
+    };
+    removeFrom(m_itemsByName, node->name);
+    removeFrom(m_itemsByType, node->type);
+
+    m_nodes.erase(node);
+}
+
+void QtItemIndex::onChildrenChanged(QQuickItem* item)
+{
+    // Removed children are handled by their parentChanged signal
+    for (auto child : item->childItems()) {
+        add(child);
+    }
+}
+
+void QtItemIndex::onParentChanged(QQuickItem* item)
+{
+    auto parent = item->parentItem();
+    if (!parent || !m_nodes.contains(parent)) {
+        remove(item);
+    }
+}
+
+void QtItemIndex::onNameChanged(QQuickItem* item)
+{
+    auto node = m_nodes.find(item);
+    if (node == m_nodes.end()) {
+        return;
+    }
+
+    auto name = GetObjectName(item);
+    if (name == node->name) {
+        return;
+    }
+
+    auto items = m_itemsByName.find(node->name);
+    if (items != m_itemsByName.end()) {
+        items->remove(item);
+        if (items->isEmpty()) {
+            m_itemsByName.erase(items);
+        }
+    }
+    if (!name.isEmpty()) {
+        m_itemsByName[name].insert(item);
+    }
+    node->name = name;
+}
+
+bool QtItemIndex::matchesAncestors(QQuickItem* item, const CompiledPath& path) const
+{
+    // Match the components between the window and the item bottom up. The search
+    // starts at the root item, so it may match a component itself.
+    auto unmatched = path.size() - 2;
+    for (auto ancestor = item->parentItem(); ancestor && unmatched > 0; ancestor = ancestor->parentItem()) {
+        if (ObjectMatchesSelector(ancestor, path[unmatched])) {
+            --unmatched;
+        }
+        if (ancestor == m_root) {
+            break;
+        }
+    }
+
+    return unmatched == 0;
+}
+
+bool QtItemIndex::isBeforeInTree(QQuickItem* item, int itemDepth, QQuickItem* other, int otherDepth) const
+{
+    // Qt does not signal when siblings are restacked, so the order is read from the tree
+    // on each lookup. Walking up the parents needs no allocations.
+    auto depth = std::min(itemDepth, otherDepth);
+    auto itemAncestor = AncestorAtDepth(item, itemDepth, depth);
+    auto otherAncestor = AncestorAtDepth(other, otherDepth, depth);
+
+    // An ancestor is found before its descendants
+    if (itemAncestor == otherAncestor) {
+        return itemDepth < otherDepth;
+    }
+
+    while (itemAncestor->parentItem() != otherAncestor->parentItem()) {
+        itemAncestor = itemAncestor->parentItem();
+        otherAncestor = otherAncestor->parentItem();
+    }
+    auto parent = itemAncestor->parentItem();
+    if (!parent) {
+        return false;
+    }
+
+    const auto siblings = parent->childItems();
+    return siblings.indexOf(itemAncestor) < siblings.indexOf(otherAncestor);
+}
+
+} // namespace qt
+} // namespace spix
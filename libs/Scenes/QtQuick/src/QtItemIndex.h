@@ -0,0 +1,79 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <FindQtItem.h>
+#include <Spix/Data/ItemPath.h>
+
+#include <QHash>
+#include <QMetaObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSet>
+#include <QString>
+
+#include <vector>
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Index of the items below a root item by name and by type
+ *
+ * The index is built once for the whole tree and then kept up to date
+ * through the change signals of the indexed items. Looking up a path then
+ * only needs to check the items that match the last path component instead
+ * of walking the whole tree.
+ */
+class QtItemIndex {
+public:
+    explicit QtItemIndex(QQuickItem* root);
+    QtItemIndex(const QtItemIndex&) = delete;
+    QtItemIndex& operator=(const QtItemIndex&) = delete;
+    ~QtItemIndex();
+
+    QQuickItem* root() const { return m_root; }
+    int size() const { return m_nodes.size(); }
+
+    /**
+     * @brief Find the item at the given path
+     *
+     * Only paths made of name and type selectors can be resolved. If there
+     * are several matching items, the one that a depth first search would
+     * find first is returned.
+     *
+     * @param path The item path, including the window component
+     * @return The item if found, nullptr if the path has to be resolved by
+     * a search of the tree
+     */
+    QQuickItem* findItem(const ItemPath& path) const;
+
+private:
+    struct Node {
+        QString name;
+        QString type;
+        std::vector<QMetaObject::Connection> connections;
+    };
+
+    void add(QQuickItem* item);
+    void remove(QQuickItem* item);
+    void removeNode(QQuickItem* item);
+    void onChildrenChanged(QQuickItem* item);
+    void onParentChanged(QQuickItem* item);
+    void onNameChanged(QQuickItem* item);
+
+    bool matchesAncestors(QQuickItem* item, const CompiledPath& path) const;
+    bool isBeforeInTree(QQuickItem* item, int itemDepth, QQuickItem* other, int otherDepth) const;
+
+    QPointer<QQuickItem> m_root;
+    QHash<QQuickItem*, Node> m_nodes;
+    QHash<QString, QSet<QQuickItem*>> m_itemsByName;
+    QHash<QString, QSet<QQuickItem*>> m_itemsByType;
+};
+
+} // namespace qt
+} // namespace spix
@@ -7,6 +7,7 @@
 #include "QtItemTools.h"
 
 #include <QDateTime>
+#include <QHash>
 #include <QQmlContext>
 #include <QQuickItem>
 #include <QRegularExpression>
@@ -53,9 +54,19 @@ QString TypeStringForObject(QObject* object)
         return "";
     }
 
-    auto typeName = QString(object->metaObject()->className());
-    typeName.replace(QRegularExpression("QQuick|_QML.*"), "");
-    return typeName;
+    // Type names are needed for every object visited in a search, so they are only built once per class
+    static QHash<const QMetaObject*, QString> typeNames;
+    const QMetaObject* metaObject = object->metaObject();
+    auto typeName = typeNames.constFind(metaObject);
+    if (typeName != typeNames.constEnd()) {
+        return *typeName;
+    }
+
+    static const QRegularExpression qtPrefixAndQmlSuffix("QQuick|_QML.*");
+    auto newTypeName = QString(metaObject->className());
+    newTypeName.replace(qtPrefixAndQmlSuffix, "");
+    typeNames.insert(metaObject, newTypeName);
+    return newTypeName;
 }
 
 void ForEachChild(QObject* object, const std::function<bool(QObject*)>& callback)
@@ -65,8 +76,7 @@ void ForEachChild(QObject* object, const std::function<bool(QObject*)>& callback
     }
 
     // Special handling for QQuickRepeater objects
-    auto rootClassName = object->metaObject()->className();
-    if (rootClassName == repeater_class_name) {
+    if (repeater_class_name == QLatin1String(object->metaObject()->className())) {
         QQuickItem* repeaterItem = static_cast<QQuickItem*>(object);
 
         // Iterate through repeater's generated items
@@ -0,0 +1,98 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtItemTreeWatcher.h"
+
+namespace spix {
+namespace qt {
+
+QtItemTreeWatcher::QtItemTreeWatcher(QQuickItem* root, ChangeHandler handler)
+: m_root(root)
+, m_handler(std::move(handler))
+{
+    watch(root);
+}
+
+QtItemTreeWatcher::~QtItemTreeWatcher()
+{
+    for (const auto& connections : m_connections) {
+        for (const auto& connection : connections) {
+            QObject::disconnect(connection);
+        }
+    }
+}
+
+void QtItemTreeWatcher::watch(QQuickItem* item)
+{
+    if (!item || m_connections.contains(item)) {
+        return;
+    }
+
+    std::vector<QMetaObject::Connection> connections;
+    connections.push_back(
+        QObject::connect(item, &QQuickItem::childrenChanged, [this, item] { onChildrenChanged(item); }));
+    connections.push_back(QObject::connect(item, &QObject::objectNameChanged, [this] { m_handler(); }));
+    connections.push_back(QObject::connect(item, &QQuickItem::visibleChanged, [this] { m_handler(); }));
+    connections.push_back(QObject::connect(item, &QObject::destroyed, [this, item] {
+        unwatchNode(item);
+        m_handler();
+    }));
+    if (item != m_root) {
+        connections.push_back(
+            QObject::connect(item, &QQuickItem::parentChanged, [this, item] { onParentChanged(item); }));
+    }
+    m_connections.insert(item, std::move(connections));
+
+    for (auto child : item->childItems()) {
+        watch(child);
+    }
+}
+
+void QtItemTreeWatcher::unwatch(QQuickItem* item)
+{
+    if (!m_connections.contains(item)) {
+        return;
+    }
+
+    for (auto child : item->childItems()) {
+        unwatch(child);
+    }
+    unwatchNode(item);
+}
+
+void QtItemTreeWatcher::unwatchNode(QQuickItem* item)
+{
+    auto connections = m_connections.find(item);
+    if (connections == m_connections.end()) {
+        return;
+    }
+
+    for (const auto& connection : *connections) {
+        QObject::disconnect(connection);
+    }
+    m_connections.erase(connections);
+}
+
+void QtItemTreeWatcher::onChildrenChanged(QQuickItem* item)
+{
+    // Removed children are handled by their parentChanged signal
+    for (auto child : item->childItems()) {
+        watch(child);
+    }
+    m_handler();
+}
+
+void QtItemTreeWatcher::onParentChanged(QQuickItem* item)
+{
+    auto parent = item->parentItem();
+    if (!parent || !m_connections.contains(parent)) {
+        unwatch(item);
+    }
+    m_handler();
+}
+
+} // namespace qt
+} // namespace spix
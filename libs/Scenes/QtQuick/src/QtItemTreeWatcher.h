@@ -0,0 +1,55 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <QHash>
+#include <QMetaObject>
+#include <QPointer>
+#include <QQuickItem>
+
+#include <functional>
+#include <vector>
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Reports changes of an item tree that can change what a path resolves to
+ *
+ * Watches all items below a root for added children, reparented and
+ * destroyed items, changed object names and visibility. Items that are
+ * added later, e.g. by a Loader or a Repeater, are watched as well.
+ *
+ * The handler is called for every change, so it should only note that
+ * something changed and return.
+ */
+class QtItemTreeWatcher {
+public:
+    using ChangeHandler = std::function<void()>;
+
+    QtItemTreeWatcher(QQuickItem* root, ChangeHandler handler);
+    QtItemTreeWatcher(const QtItemTreeWatcher&) = delete;
+    QtItemTreeWatcher& operator=(const QtItemTreeWatcher&) = delete;
+    ~QtItemTreeWatcher();
+
+    QQuickItem* root() const { return m_root; }
+    int size() const { return m_connections.size(); }
+
+private:
+    void watch(QQuickItem* item);
+    void unwatch(QQuickItem* item);
+    void unwatchNode(QQuickItem* item);
+    void onChildrenChanged(QQuickItem* item);
+    void onParentChanged(QQuickItem* item);
+
+    QPointer<QQuickItem> m_root;
+    ChangeHandler m_handler;
+    QHash<QQuickItem*, std::vector<QMetaObject::Connection>> m_connections;
+};
+
+} // namespace qt
+} // namespace spix
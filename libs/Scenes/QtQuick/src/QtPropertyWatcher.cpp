@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtPropertyWatcher.h"
+
+#include <QMetaMethod>
+#include <QMetaProperty>
+
+namespace spix {
+namespace qt {
+
+std::unique_ptr<QtPropertyWatcher> QtPropertyWatcher::create(
+    QObject* object, const char* property, ChangeHandler handler)
+{
+    if (!object) {
+        return {};
+    }
+
+    auto metaObject = object->metaObject();
+    auto propertyIndex = metaObject->indexOfProperty(property);
+    if (propertyIndex < 0) {
+        return {};
+    }
+    auto metaProperty = metaObject->property(propertyIndex);
+    if (!metaProperty.hasNotifySignal()) {
+        return {};
+    }
+
+    std::unique_ptr<QtPropertyWatcher> watcher(new QtPropertyWatcher(object, std::move(handler)));
+    auto slot = watcher->metaObject()->method(watcher->metaObject()->indexOfSlot("onChanged()"));
+    QObject::connect(object, metaProperty.notifySignal(), watcher.get(), slot);
+    QObject::connect(object, &QObject::destroyed, watcher.get(), &QtPropertyWatcher::onChanged);
+
+    return watcher;
+}
+
+QtPropertyWatcher::QtPropertyWatcher(QObject* object, ChangeHandler handler)
+: m_object(object)
+, m_handler(std::move(handler))
+{
+}
+
+void QtPropertyWatcher::onChanged()
+{
+    m_handler();
+}
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <QObject>
+#include <QPointer>
+
+#include <functional>
+#include <memory>
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Reports changes of one property of an object
+ *
+ * Connects to the NOTIFY signal of the property, which can have any
+ * signature, so it needs a slot of its own. The handler is also called
+ * when the object is destroyed.
+ */
+class QtPropertyWatcher : public QObject {
+    Q_OBJECT
+
+public:
+    using ChangeHandler = std::function<void()>;
+
+    /**
+     * @brief Watch `property` of `object`
+     *
+     * Returns nullptr if the object has no such property or the
+     * property has no NOTIFY signal.
+     */
+    static std::unique_ptr<QtPropertyWatcher> create(QObject* object, const char* property, ChangeHandler handler);
+
+    QObject* object() const { return m_object; }
+
+private slots:
+    void onChanged();
+
+private:
+    QtPropertyWatcher(QObject* object, ChangeHandler handler);
+
+    QPointer<QObject> m_object;
+    ChangeHandler m_handler;
+};
+
+} // namespace qt
+} // namespace spix
@@ -18,7 +18,25 @@ QtQmlBot::QtQmlBot(QObject* parent)
 , m_scene(std::make_unique<QtScene>())
 , m_cmdExec(std::make_unique<CommandExecuter>())
 {
-    startTimer(10);
+    // Process commands as soon as they arrive instead of waiting for the next timer tick
+    m_cmdExec->setWakeupHandler(
+        [this] { QMetaObject::invokeMethod(this, [this] { processCommands(); }, Qt::QueuedConnection); });
+
+    // Check waiting commands right after the item tree or a watched property changed instead
+    // of on the next polling tick. Changes often come in bursts, so only one check is queued at a time.
+    m_scene->setChangeHandler([this] {
+        if (m_pollingTimerId == 0 || m_changePending) {
+            return;
+        }
+        m_changePending = true;
+        QMetaObject::invokeMethod(
+            this,
+            [this] {
+                m_changePending = false;
+                processCommands();
+            },
+            Qt::QueuedConnection);
+    });
 }
 
 QtQmlBot::~QtQmlBot() = default;
@@ -30,9 +48,38 @@ void QtQmlBot::runTestServer(TestServer& server)
     server.start();
 }
 
+void QtQmlBot::setPollingInterval(std::chrono::milliseconds interval)
+{
+    m_pollingInterval = interval;
+    if (m_pollingTimerId != 0) {
+        killTimer(m_pollingTimerId);
+        m_pollingTimerId = startTimer(m_cmdExec->nextCheckDelay(m_pollingInterval), Qt::PreciseTimer);
+    }
+}
+
+void QtQmlBot::setItemIndexEnabled(bool enabled)
+{
+    m_scene->setItemIndexEnabled(enabled);
+}
+
 void QtQmlBot::timerEvent(QTimerEvent*)
+{
+    processCommands();
+}
+
+void QtQmlBot::processCommands()
 {
     m_cmdExec->processCommands(*m_scene);
+
+    // Only keep a timer running while commands are waiting for something. It fires
+    // right at the deadline if the waiting commands do not have to be polled.
+    if (m_pollingTimerId != 0) {
+        killTimer(m_pollingTimerId);
+        m_pollingTimerId = 0;
+    }
+    if (m_cmdExec->hasPendingCommands()) {
+        m_pollingTimerId = startTimer(m_cmdExec->nextCheckDelay(m_pollingInterval), Qt::PreciseTimer);
+    }
 }
 
 } // namespace spix
@@ -7,6 +7,7 @@
 #include "QtScene.h"
 #include "FindQtItem.h"
 
+#include <QtImage.h>
 #include <QtItem.h>
 #include <QtItemTools.h>
 #include <Spix/Data/ItemPath.h>
@@ -14,12 +15,53 @@
 #include <QBuffer>
 #include <QByteArray>
 #include <QGuiApplication>
+#include <QImage>
 #include <QObject>
+#include <QPointer>
 #include <QQuickItem>
+#include <QQuickItemGrabResult>
 #include <QQuickWindow>
+#include <QTimer>
 
 namespace spix {
 
+namespace {
+
+// Rendering an item on its own needs a frame of its window. A window that is
+// not exposed renders no frames, so the item is cropped from it after this.
+constexpr int itemGrabTimeoutMs = 1000;
+
+QRect ItemRectInWindowImage(QQuickItem* item, const QImage& windowImage)
+{
+    // get the rect of the item in window space in pixels, account for the device pixel ratio
+    QRectF imageCropRectItemSpace {0, 0, item->width(), item->height()};
+    auto imageCropRectF = item->mapRectToScene(imageCropRectItemSpace);
+    return QRect(imageCropRectF.x() * windowImage.devicePixelRatio(),
+        imageCropRectF.y() * windowImage.devicePixelRatio(), imageCropRectF.width() * windowImage.devicePixelRatio(),
+        imageCropRectF.height() * windowImage.devicePixelRatio());
+}
+
+QImage GrabItemImage(QQuickItem* item)
+{
+    // take screenshot of the full window and crop it to the item rect
+    auto windowImage = item->window()->grabWindow();
+    return windowImage.copy(ItemRectInWindowImage(item, windowImage));
+}
+
+std::unique_ptr<Image> CropItemImage(QQuickItem* item, const std::shared_ptr<const QtImage>& windowImage)
+{
+    // the pixels are only copied when they are read, i.e. on a worker for encoded screenshots
+    auto rect = ItemRectInWindowImage(item, windowImage->qimage());
+    return std::make_unique<CroppedImage>(windowImage, rect.x(), rect.y(), rect.width(), rect.height());
+}
+
+std::unique_ptr<Image> GrabCroppedItemImage(QQuickItem* item)
+{
+    return CropItemImage(item, std::make_shared<QtImage>(item->window()->grabWindow()));
+}
+
+} // namespace
+
 std::unique_ptr<Item> QtScene::itemAtPath(const ItemPath& path)
 {
     auto window = qt::GetQQuickWindowAtPath(path);
@@ -31,7 +73,7 @@ std::unique_ptr<Item> QtScene::itemAtPath(const ItemPath& path)
         return std::make_unique<QtItem>(window);
     }
 
-    auto item = qt::GetQQuickItemAtPath(path);
+    auto item = findItem(path);
 
     if (!item) {
         return {};
@@ -47,45 +89,23 @@ Events& QtScene::events()
 
 void QtScene::takeScreenshot(const ItemPath& targetItem, const std::string& filePath)
 {
-    auto item = qt::GetQQuickItemAtPath(targetItem);
+    auto item = findItem(targetItem);
     if (!item) {
         return;
     }
 
-    // take screenshot of the full window
-    auto windowImage = item->window()->grabWindow();
-
-    // get the rect of the item in window space in pixels, account for the device pixel ratio
-    QRectF imageCropRectItemSpace {0, 0, item->width(), item->height()};
-    auto imageCropRectF = item->mapRectToScene(imageCropRectItemSpace);
-    QRect imageCropRect(imageCropRectF.x() * windowImage.devicePixelRatio(),
-        imageCropRectF.y() * windowImage.devicePixelRatio(), imageCropRectF.width() * windowImage.devicePixelRatio(),
-        imageCropRectF.height() * windowImage.devicePixelRatio());
-
-    // crop the window image to the item rect
-    auto image = windowImage.copy(imageCropRect);
+    auto image = GrabItemImage(item);
     image.save(QString::fromStdString(filePath));
 }
 
 std::string QtScene::takeScreenshotAsBase64(const ItemPath& targetItem)
 {
-    auto item = qt::GetQQuickItemAtPath(targetItem);
+    auto item = findItem(targetItem);
     if (!item) {
         return "";
     }
 
-    // take screenshot of the full window
-    auto windowImage = item->window()->grabWindow();
-
-    // get the rect of the item in window space in pixels, account for the device pixel ratio
-    QRectF imageCropRectItemSpace {0, 0, item->width(), item->height()};
-    auto imageCropRectF = item->mapRectToScene(imageCropRectItemSpace);
-    QRect imageCropRect(imageCropRectF.x() * windowImage.devicePixelRatio(),
-        imageCropRectF.y() * windowImage.devicePixelRatio(), imageCropRectF.width() * windowImage.devicePixelRatio(),
-        imageCropRectF.height() * windowImage.devicePixelRatio());
-
-    // crop the window image to the item rect
-    auto image = windowImage.copy(imageCropRect);
+    auto image = GrabItemImage(item);
     QByteArray byteArray;
     QBuffer buffer(&byteArray);
     buffer.open(QIODevice::WriteOnly);
@@ -95,4 +115,322 @@ std::string QtScene::takeScreenshotAsBase64(const ItemPath& targetItem)
     return byteArray.toBase64().toStdString();
 }
 
+std::unique_ptr<Image> QtScene::grabImage(const ItemPath& targetItem)
+{
+    auto item = findItem(targetItem);
+    if (!item) {
+        return {};
+    }
+
+    return GrabCroppedItemImage(item);
+}
+
+void QtScene::grabImageAsync(const ItemPath& targetItem, CaptureMode mode, ImageHandler handler)
+{
+    auto item = findItem(targetItem);
+    if (!item) {
+        handler(nullptr);
+        return;
+    }
+
+    // grabToImage renders only the item into an item sized texture with the next frame
+    auto grab = mode == CaptureMode::Item ? item->grabToImage() : QSharedPointer<QQuickItemGrabResult>();
+    if (!grab) {
+        handler(GrabCroppedItemImage(item));
+        return;
+    }
+
+    // the handler is called once, by whichever comes first
+    auto done = std::make_shared<bool>(false);
+    auto result = grab.data();
+    auto connection = QObject::connect(result, &QQuickItemGrabResult::ready, result, [grab, handler, done]() mutable {
+        if (!*done) {
+            *done = true;
+            handler(std::make_unique<QtImage>(grab->image()));
+        }
+
+        // this connection keeps the result alive until it is ready,
+        // release it once the signal has been delivered
+        QMetaObject::invokeMethod(qApp, [grab = std::move(grab)]() {}, Qt::QueuedConnection);
+    });
+
+    QTimer::singleShot(itemGrabTimeoutMs, qApp, [item = QPointer<QQuickItem>(item), handler, done, connection]() {
+        if (*done) {
+            return;
+        }
+        *done = true;
+        // releases the result that is never going to be ready
+        QObject::disconnect(connection);
+        handler(item && item->window() ? GrabCroppedItemImage(item) : nullptr);
+    });
+}
+
+std::vector<std::unique_ptr<Image>> QtScene::grabImages(const std::vector<ItemPath>& targetItems)
+{
+    // every grab reads back the full window, so grab each window only once
+    std::unordered_map<QQuickWindow*, std::shared_ptr<const QtImage>> windowImages;
+
+    std::vector<std::unique_ptr<Image>> images;
+    images.reserve(targetItems.size());
+    for (const auto& targetItem : targetItems) {
+        auto item = findItem(targetItem);
+        if (!item) {
+            images.push_back(nullptr);
+            continue;
+        }
+
+        auto window = item->window();
+        auto windowImage = windowImages.find(window);
+        if (windowImage == windowImages.end()) {
+            windowImage = windowImages.emplace(window, std::make_shared<QtImage>(window->grabWindow())).first;
+        }
+        images.push_back(CropItemImage(item, windowImage->second));
+    }
+
+    return images;
+}
+
+std::unique_ptr<Image> QtScene::loadImage(const std::string& filePath)
+{
+    QImage image(QString::fromStdString(filePath));
+    if (image.isNull()) {
+        return {};
+    }
+
+    return std::make_unique<QtImage>(std::move(image));
+}
+
+bool QtScene::startRecording(const ItemPath& windowPath, int fps, const std::string& filePath)
+{
+    auto window = qt::GetQQuickWindowAtPath(windowPath);
+    if (!window || m_recording) {
+        return false;
+    }
+
+    auto recorder = std::make_unique<FrameRecorder>(filePath, fps);
+    if (!recorder->isOpen()) {
+        return false;
+    }
+
+    m_recording = std::make_unique<qt::QtWindowRecorder>(window, std::move(recorder));
+    return true;
+}
+
+std::unique_ptr<FrameRecorder> QtScene::stopRecording()
+{
+    if (!m_recording) {
+        return {};
+    }
+
+    auto recorder = m_recording->stop();
+    m_recording.reset();
+    return recorder;
+}
+
+long long QtScene::renderedFrames(const ItemPath& path)
+{
+    auto item = findItem(path);
+    if (!item || !item->window()) {
+        return -1;
+    }
+
+    // A window at the address of a destroyed one gets a new counter
+    auto window = item->window();
+    auto& counter = m_frameCounters[window];
+    if (counter.window != window) {
+        counter.window = window;
+        counter.frames = std::make_shared<std::atomic<long long>>(0);
+        QObject::connect(window, &QQuickWindow::frameSwapped, [frames = counter.frames]() { ++*frames; });
+    }
+
+    return counter.frames->load();
+}
+
+long long QtScene::itemTreeChanges(const ItemPath& path)
+{
+    // selectors by text or property values can match after any property change
+    auto compiledPath = qt::CompilePath(path);
+    for (size_t i = 1; i < compiledPath.size(); ++i) {
+        auto kind = compiledPath[i].kind;
+        if (kind != qt::CompiledSelector::Kind::Name && kind != qt::CompiledSelector::Kind::Type) {
+            return -1;
+        }
+    }
+
+    auto window = qt::GetQQuickWindowAtPath(path);
+    if (!window || !window->contentItem()) {
+        return -1;
+    }
+
+    // Path components match at any depth, so the whole item tree of the window
+    // is watched. A window at the address of a destroyed one gets a new watcher.
+    auto& watcher = m_itemTreeWatchers[window];
+    if (!watcher || watcher->root() != window->contentItem()) {
+        watcher = std::make_unique<qt::QtItemTreeWatcher>(
+            window->contentItem(), [this] { notifyChange(m_itemTreeChanges); });
+        ++m_itemTreeChanges;
+    }
+
+    return m_itemTreeChanges;
+}
+
+long long QtScene::propertyChanges(const ItemPath& path, const std::string& property)
+{
+    return propertyChanges(path, std::vector<std::string> {property}).front();
+}
+
+std::vector<long long> QtScene::propertyChanges(const ItemPath& path, const std::vector<std::string>& properties)
+{
+    std::vector<long long> changes(properties.size(), -1);
+
+    // The path can resolve to another item after the item tree changed,
+    // so tree changes count as changes of the property as well.
+    auto treeChanges = itemTreeChanges(path);
+    if (treeChanges < 0) {
+        return changes;
+    }
+
+    // the path is resolved once for all properties
+    QObject* object = qt::GetQQuickWindowAtPath(path);
+    if (path.length() > 1) {
+        object = findItem(path);
+    }
+
+    auto pathString = path.string();
+    for (size_t i = 0; i < properties.size(); ++i) {
+        if (!object) {
+            // a watch of a destroyed item must not hide that the path resolves again
+            m_propertyWatches.erase(std::make_pair(pathString, properties[i]));
+            continue;
+        }
+
+        // both counters only grow, so their sum changes whenever one of them does
+        auto lastChange = watchProperty(object, pathString, properties[i]);
+        if (lastChange >= 0) {
+            changes[i] = lastChange + treeChanges;
+        }
+    }
+    return changes;
+}
+
+long long QtScene::watchProperty(QObject* object, const std::string& pathString, const std::string& property)
+{
+    // Watches of finished waits are not removed, so the number of watches
+    // is bounded by dropping all of them now and then. Subscriptions keep
+    // their properties watched, so this has to be well above their number.
+    constexpr size_t maxPropertyWatches = 1024;
+    auto key = std::make_pair(pathString, property);
+    auto watch = m_propertyWatches.find(key);
+    if (watch == m_propertyWatches.end() && m_propertyWatches.size() >= maxPropertyWatches) {
+        m_propertyWatches.clear();
+    }
+
+    // the path can resolve to a different item after the tree changed
+    if (watch == m_propertyWatches.end() || watch->second.watcher->object() != object) {
+        m_propertyWatches.erase(key);
+        auto lastChange = std::make_shared<long long>(++m_propertyChanges);
+        auto watcher = qt::QtPropertyWatcher::create(object, property.c_str(), [this, lastChange] {
+            notifyChange(m_propertyChanges);
+            *lastChange = m_propertyChanges;
+        });
+        if (!watcher) {
+            return -1;
+        }
+        watch = m_propertyWatches.emplace(key, PropertyWatch {std::move(watcher), std::move(lastChange)}).first;
+    }
+
+    return *watch->second.lastChange;
+}
+
+Variant::MapType QtScene::statistics()
+{
+    auto statistics = m_itemCache.statistics();
+
+    if (m_itemIndexEnabled) {
+        long long indexedItems = 0;
+        for (const auto& windowAndIndex : m_itemIndexes) {
+            indexedItems += windowAndIndex.second->size();
+        }
+        statistics["itemIndex.hits"] = m_itemIndexHits;
+        statistics["itemIndex.fallbacks"] = m_itemIndexFallbacks;
+        statistics["itemIndex.items"] = indexedItems;
+    }
+
+    if (!m_itemTreeWatchers.empty()) {
+        long long watchedItems = 0;
+        for (const auto& windowAndWatcher : m_itemTreeWatchers) {
+            watchedItems += windowAndWatcher.second->size();
+        }
+        statistics["itemTreeWatcher.items"] = watchedItems;
+    }
+
+    if (!m_propertyWatches.empty()) {
+        statistics["propertyWatcher.properties"] = static_cast<long long>(m_propertyWatches.size());
+    }
+
+    return statistics;
+}
+
+void QtScene::setItemIndexEnabled(bool enabled)
+{
+    m_itemIndexEnabled = enabled;
+    if (!enabled) {
+        m_itemIndexes.clear();
+    }
+}
+
+void QtScene::setChangeHandler(std::function<void()> handler)
+{
+    m_changeHandler = std::move(handler);
+}
+
+void QtScene::notifyChange(long long& counter)
+{
+    ++counter;
+    if (m_changeHandler) {
+        m_changeHandler();
+    }
+}
+
+QQuickItem* QtScene::findItem(const ItemPath& path)
+{
+    auto window = qt::GetQQuickWindowAtPath(path);
+    if (!window) {
+        return nullptr;
+    }
+
+    return m_itemCache.lookup(path, window, [&] { return resolveItem(path, window); });
+}
+
+QQuickItem* QtScene::resolveItem(const ItemPath& path, QQuickWindow* window)
+{
+    if (m_itemIndexEnabled && path.length() > 1) {
+        if (auto index = itemIndex(window)) {
+            if (auto item = index->findItem(path)) {
+                ++m_itemIndexHits;
+                return item;
+            }
+            ++m_itemIndexFallbacks;
+        }
+    }
+
+    return qt::GetQQuickItemAtPath(path);
+}
+
+qt::QtItemIndex* QtScene::itemIndex(QQuickWindow* window)
+{
+    auto contentItem = window->contentItem();
+    if (!contentItem) {
+        return nullptr;
+    }
+
+    // A window at the address of a destroyed one gets a new index
+    auto& index = m_itemIndexes[window];
+    if (!index || index->root() != contentItem) {
+        index = std::make_unique<qt::QtItemIndex>(contentItem);
+    }
+
+    return index.get();
+}
+
 } // namespace spix
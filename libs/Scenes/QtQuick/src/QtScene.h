@@ -7,12 +7,26 @@
 #pragma once
 
 #include <QByteArray>
+#include <QMetaObject>
+#include <QPointer>
 #include <QtEvents.h>
+#include <QtItemCache.h>
+#include <QtItemIndex.h>
+#include <QtItemTreeWatcher.h>
+#include <QtPropertyWatcher.h>
+#include <QtWindowRecorder.h>
 #include <Spix/Data/ItemPath.h>
 #include <Spix/Scene/Scene.h>
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+class QQuickItem;
 class QQuickWindow;
 
 namespace spix {
@@ -30,9 +44,78 @@ public:
     // Tasks
     void takeScreenshot(const ItemPath& targetItem, const std::string& filePath) override;
     std::string takeScreenshotAsBase64(const ItemPath& targetItem) override;
+    std::unique_ptr<Image> grabImage(const ItemPath& targetItem) override;
+    void grabImageAsync(const ItemPath& targetItem, CaptureMode mode, ImageHandler handler) override;
+    std::vector<std::unique_ptr<Image>> grabImages(const std::vector<ItemPath>& targetItems) override;
+    std::unique_ptr<Image> loadImage(const std::string& filePath) override;
+    bool startRecording(const ItemPath& windowPath, int fps, const std::string& filePath) override;
+    std::unique_ptr<FrameRecorder> stopRecording() override;
+    long long renderedFrames(const ItemPath& path) override;
+    long long itemTreeChanges(const ItemPath& path) override;
+    long long propertyChanges(const ItemPath& path, const std::string& property) override;
+    std::vector<long long> propertyChanges(const ItemPath& path, const std::vector<std::string>& properties) override;
+
+    // Diagnostics
+    Variant::MapType statistics() override;
+
+    /**
+     * @brief Resolve item paths through an index of item names and types
+     *
+     * The index of a window is built on its first lookup and then kept up
+     * to date as items are added, removed or renamed. This speeds up
+     * lookups in large scenes at the cost of memory and some overhead
+     * whenever the item tree changes. Disabled by default.
+     */
+    void setItemIndexEnabled(bool enabled);
+
+    /**
+     * @brief Set a handler that is called when a watched item tree or property changed
+     *
+     * Item trees are watched once a command asked for `itemTreeChanges`,
+     * properties once a command asked for `propertyChanges`. The handler
+     * is called on the main thread, possibly many times in a row, e.g.
+     * while a Repeater creates its items.
+     */
+    void setChangeHandler(std::function<void()> handler);
 
 private:
+    QQuickItem* findItem(const ItemPath& path);
+    QQuickItem* resolveItem(const ItemPath& path, QQuickWindow* window);
+    qt::QtItemIndex* itemIndex(QQuickWindow* window);
+    void notifyChange(long long& counter);
+    long long watchProperty(QObject* object, const std::string& pathString, const std::string& property);
+
     QtEvents m_events;
+    qt::QtItemCache m_itemCache;
+
+    bool m_itemIndexEnabled = false;
+    std::unordered_map<QQuickWindow*, std::unique_ptr<qt::QtItemIndex>> m_itemIndexes;
+    long long m_itemIndexHits = 0;
+    long long m_itemIndexFallbacks = 0;
+
+    std::unique_ptr<qt::QtWindowRecorder> m_recording;
+
+    // frameSwapped is emitted on the render thread
+    struct FrameCounter {
+        QPointer<QQuickWindow> window;
+        std::shared_ptr<std::atomic<long long>> frames;
+    };
+    std::unordered_map<QQuickWindow*, FrameCounter> m_frameCounters;
+
+    std::unordered_map<QQuickWindow*, std::unique_ptr<qt::QtItemTreeWatcher>> m_itemTreeWatchers;
+    long long m_itemTreeChanges = 0;
+
+    // Keyed by path and property name. Each watch remembers the value of
+    // m_propertyChanges at its last change, so that a change of one
+    // property does not make commands read all others again.
+    struct PropertyWatch {
+        std::unique_ptr<qt::QtPropertyWatcher> watcher;
+        std::shared_ptr<long long> lastChange;
+    };
+    std::map<std::pair<std::string, std::string>, PropertyWatch> m_propertyWatches;
+    long long m_propertyChanges = 0;
+
+    std::function<void()> m_changeHandler;
 };
 
 } // namespace spix
@@ -0,0 +1,64 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtWindowRecorder.h"
+
+#include <QtImage.h>
+
+#include <QQuickWindow>
+
+#include <chrono>
+
+namespace spix {
+namespace qt {
+
+QtWindowRecorder::QtWindowRecorder(QQuickWindow* window, std::unique_ptr<FrameRecorder> recorder)
+: m_window(window)
+, m_recorder(std::move(recorder))
+{
+    // frameSwapped is emitted on the render thread, the timer as
+    // context object makes it a queued call on the main thread
+    m_frameSwappedConnection
+        = QObject::connect(window, &QQuickWindow::frameSwapped, &m_timer, [this]() { m_frameSwapped = true; });
+
+    auto interval = std::chrono::duration_cast<std::chrono::milliseconds>(m_recorder->frameInterval());
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(static_cast<int>(interval.count()));
+    QObject::connect(&m_timer, &QTimer::timeout, [this]() { captureFrame(); });
+    m_timer.start();
+
+    captureFrame();
+}
+
+QtWindowRecorder::~QtWindowRecorder()
+{
+    QObject::disconnect(m_frameSwappedConnection);
+}
+
+std::unique_ptr<FrameRecorder> QtWindowRecorder::stop()
+{
+    m_timer.stop();
+    QObject::disconnect(m_frameSwappedConnection);
+    return std::move(m_recorder);
+}
+
+void QtWindowRecorder::captureFrame()
+{
+    if (!m_window || !m_recorder || !m_frameSwapped) {
+        return;
+    }
+    m_frameSwapped = false;
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto image = std::make_unique<QtImage>(m_window->grabWindow());
+    auto captureTime
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+
+    m_recorder->addFrame(std::move(image), captureTime);
+}
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,48 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Scene/FrameRecorder.h>
+
+#include <QMetaObject>
+#include <QPointer>
+#include <QTimer>
+
+#include <memory>
+
+class QQuickWindow;
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Feeds the frames of a window into a `FrameRecorder`
+ *
+ * A timer grabs the window at the target frame rate, but only if the
+ * window swapped a new frame since the last grab. A window that does
+ * not change therefore costs nothing, and the file records each frame
+ * with the time it was grabbed.
+ */
+class QtWindowRecorder {
+public:
+    QtWindowRecorder(QQuickWindow* window, std::unique_ptr<FrameRecorder> recorder);
+    ~QtWindowRecorder();
+
+    std::unique_ptr<FrameRecorder> stop();
+
+private:
+    void captureFrame();
+
+    QPointer<QQuickWindow> m_window;
+    QTimer m_timer;
+    QMetaObject::Connection m_frameSwappedConnection;
+    bool m_frameSwapped = true;
+    std::unique_ptr<FrameRecorder> m_recorder;
+};
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,58 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <FindQtItem.h>
+
+#include "QtTestUtils.h"
+
+using CompiledSelector = spix::qt::CompiledSelector;
+
+class FindQtItemTestWithQMLEngine : public QMLEngineTest {
+};
+
+TEST(FindQtItemTest, CompilesPath)
+{
+    auto compiledPath = spix::qt::CompilePath("window/button/#Rectangle/\"OK\"/(role=accept)/.child");
+    ASSERT_EQ(compiledPath.size(), 6);
+    EXPECT_EQ(compiledPath[1].kind, CompiledSelector::Kind::Name);
+    EXPECT_EQ(compiledPath[1].value, QString("button"));
+    EXPECT_EQ(compiledPath[2].kind, CompiledSelector::Kind::Type);
+    EXPECT_EQ(compiledPath[2].value, QString("Rectangle"));
+    EXPECT_EQ(compiledPath[3].kind, CompiledSelector::Kind::Value);
+    EXPECT_EQ(compiledPath[3].value, QString("OK"));
+    EXPECT_EQ(compiledPath[4].kind, CompiledSelector::Kind::PropertyValue);
+    EXPECT_EQ(compiledPath[4].property, QByteArray("role"));
+    EXPECT_EQ(compiledPath[4].value, QString("accept"));
+    EXPECT_EQ(compiledPath[5].kind, CompiledSelector::Kind::Property);
+    EXPECT_EQ(compiledPath[5].property, QByteArray("child"));
+}
+
+TEST_F(FindQtItemTestWithQMLEngine, ObjectMatchesSelector)
+{
+    auto item = GetQQuickItemWithMethod(R"(
+        objectName: "button"
+        property string text: "OK"
+        property string role: "accept"
+        property Item child: Item {}
+    )");
+
+    auto matching = spix::qt::CompilePath("window/button/#Item/\"OK\"/(role=accept)");
+    for (size_t i = 1; i < matching.size(); ++i) {
+        EXPECT_TRUE(spix::qt::ObjectMatchesSelector(item, matching[i])) << i;
+    }
+
+    auto notMatching = spix::qt::CompilePath("window/other/#Rectangle/\"Cancel\"/(role=reject)/(size=1)");
+    for (size_t i = 1; i < notMatching.size(); ++i) {
+        EXPECT_FALSE(spix::qt::ObjectMatchesSelector(item, notMatching[i])) << i;
+    }
+
+    // A property selector refers to another object, not to the item itself
+    auto property = spix::qt::CompileSelector(spix::path::PropertySelector("child"));
+    EXPECT_FALSE(spix::qt::ObjectMatchesSelector(item, property));
+    EXPECT_FALSE(spix::qt::ObjectMatchesSelector(nullptr, matching[1]));
+}
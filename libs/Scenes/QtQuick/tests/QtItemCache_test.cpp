@@ -0,0 +1,109 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <FindQtItem.h>
+#include <QtItemCache.h>
+
+#include "QtTestUtils.h"
+
+namespace {
+
+const char* itemTree = R"(
+Item {
+    objectName: "root"
+    Item {
+        objectName: "first"
+        Item { objectName: "target" }
+    }
+    Item {
+        objectName: "second"
+        Item { objectName: "target" }
+    }
+}
+)";
+
+} // namespace
+
+class QtItemCacheTest : public QQuickWindowTest {
+protected:
+    QQuickItem* lookup(const char* path)
+    {
+        spix::ItemPath itemPath(path);
+        return cache.lookup(itemPath, &window, [&] { return spix::qt::GetQQuickItemAtPath(itemPath); });
+    }
+
+    spix::qt::QtItemCache cache;
+};
+
+TEST_F(QtItemCacheTest, HitsReturnTheCachedItem)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    auto first = root->findChild<QQuickItem*>("first");
+
+    EXPECT_EQ(lookup("window/first"), first);
+    EXPECT_EQ(lookup("window/first"), first);
+    EXPECT_EQ(lookup("window/#Item"), spix::qt::GetQQuickItemAtPath("window/#Item"));
+
+    auto statistics = cache.statistics();
+    EXPECT_EQ(statistics["itemCache.hits"], spix::Variant(1LL));
+    EXPECT_EQ(statistics["itemCache.misses"], spix::Variant(2LL));
+}
+
+TEST_F(QtItemCacheTest, RenamedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    auto firstTarget = root->findChild<QQuickItem*>("first")->findChild<QQuickItem*>("target");
+    auto secondTarget = root->findChild<QQuickItem*>("second")->findChild<QQuickItem*>("target");
+
+    EXPECT_EQ(lookup("window/target"), firstTarget);
+    EXPECT_EQ(lookup("window/renamed"), nullptr);
+
+    firstTarget->setObjectName("renamed");
+    EXPECT_EQ(lookup("window/target"), secondTarget);
+    EXPECT_EQ(lookup("window/target"), spix::qt::GetQQuickItemAtPath("window/target"));
+    EXPECT_EQ(lookup("window/renamed"), firstTarget);
+
+    // Renaming an ancestor changes the paths of its descendants
+    root->findChild<QQuickItem*>("second")->setObjectName("other");
+    EXPECT_EQ(lookup("window/second/target"), nullptr);
+    EXPECT_EQ(lookup("window/other/target"), secondTarget);
+}
+
+TEST_F(QtItemCacheTest, ReparentedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    auto first = root->findChild<QQuickItem*>("first");
+    auto secondTarget = root->findChild<QQuickItem*>("second")->findChild<QQuickItem*>("target");
+
+    EXPECT_EQ(lookup("window/second/target"), secondTarget);
+    EXPECT_EQ(lookup("window/first/target"), first->childItems().first());
+
+    // The reparented item now comes first within its new parent
+    secondTarget->setParentItem(first);
+    secondTarget->stackBefore(first->childItems().first());
+    EXPECT_EQ(lookup("window/second/target"), nullptr);
+    EXPECT_EQ(lookup("window/first/target"), secondTarget);
+    EXPECT_EQ(lookup("window/first/target"), spix::qt::GetQQuickItemAtPath("window/first/target"));
+}
+
+TEST_F(QtItemCacheTest, DeletedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    auto firstTarget = root->findChild<QQuickItem*>("first")->findChild<QQuickItem*>("target");
+    auto secondTarget = root->findChild<QQuickItem*>("second")->findChild<QQuickItem*>("target");
+
+    EXPECT_EQ(lookup("window/target"), firstTarget);
+    EXPECT_EQ(lookup("window/second/target"), secondTarget);
+
+    delete firstTarget;
+    EXPECT_EQ(lookup("window/target"), secondTarget);
+
+    delete secondTarget;
+    EXPECT_EQ(lookup("window/second/target"), nullptr);
+    EXPECT_EQ(lookup("window/target"), nullptr);
+}
@@ -0,0 +1,109 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <FindQtItem.h>
+#include <QtItemIndex.h>
+
+#include "QtTestUtils.h"
+
+namespace {
+
+const char* itemTree = R"(
+Item {
+    objectName: "root"
+    Item {
+        objectName: "first"
+        Item { objectName: "target" }
+        Rectangle { objectName: "rect" }
+    }
+    Item {
+        objectName: "second"
+        Item { objectName: "target" }
+    }
+}
+)";
+
+const char* paths[] = {"window/target", "window/root/target", "window/first/target", "window/second/target",
+    "window/renamed", "window/#Item", "window/#Rectangle", "window/second/#Rectangle", "window/root/#Item/target",
+    "window/missing"};
+
+} // namespace
+
+class QtItemIndexTest : public QQuickWindowTest {
+protected:
+    // The index has to find the same items as a search of the tree
+    void ExpectSameItemsAsSearch(const spix::qt::QtItemIndex& index)
+    {
+        for (auto path : paths) {
+            EXPECT_EQ(index.findItem(path), spix::qt::GetQQuickItemAtPath(path)) << path;
+        }
+    }
+};
+
+TEST_F(QtItemIndexTest, FindsItemsInSearchOrder)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    spix::qt::QtItemIndex index(window.contentItem());
+
+    EXPECT_EQ(index.findItem("window/target"), root->findChild<QQuickItem*>("first")->childItems().first());
+    EXPECT_EQ(index.findItem("window/#Rectangle"), root->findChild<QQuickItem*>("rect"));
+    ExpectSameItemsAsSearch(index);
+}
+
+TEST_F(QtItemIndexTest, RenamedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    spix::qt::QtItemIndex index(window.contentItem());
+
+    root->findChild<QQuickItem*>("first")->childItems().first()->setObjectName("renamed");
+    ExpectSameItemsAsSearch(index);
+
+    root->findChild<QQuickItem*>("second")->setObjectName("first");
+    ExpectSameItemsAsSearch(index);
+}
+
+TEST_F(QtItemIndexTest, ReparentedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    spix::qt::QtItemIndex index(window.contentItem());
+    auto first = root->findChild<QQuickItem*>("first");
+    auto second = root->findChild<QQuickItem*>("second");
+
+    first->findChild<QQuickItem*>("rect")->setParentItem(second);
+    ExpectSameItemsAsSearch(index);
+
+    // Moving an item in front of its siblings changes which one is found first
+    second->stackBefore(first);
+    ExpectSameItemsAsSearch(index);
+
+    // Items outside of the tree are dropped, items moved into it are added
+    auto target = second->childItems().first();
+    target->setParentItem(nullptr);
+    EXPECT_EQ(index.findItem("window/second/target"), nullptr);
+    target->setParentItem(first);
+    ExpectSameItemsAsSearch(index);
+}
+
+TEST_F(QtItemIndexTest, AddedAndDeletedItems)
+{
+    auto root = GetQQuickItemInWindow(itemTree);
+    spix::qt::QtItemIndex index(window.contentItem());
+    const auto initialSize = index.size();
+
+    auto added = GetQQuickItemInWindow("Item { objectName: \"second\"\n Item { objectName: \"target\" } }");
+    EXPECT_EQ(index.size(), initialSize + 2);
+    ExpectSameItemsAsSearch(index);
+
+    delete root->findChild<QQuickItem*>("second");
+    EXPECT_EQ(index.findItem("window/second/target"), added->childItems().first());
+    ExpectSameItemsAsSearch(index);
+
+    delete root;
+    EXPECT_EQ(index.size(), 3);
+    ExpectSameItemsAsSearch(index);
+}
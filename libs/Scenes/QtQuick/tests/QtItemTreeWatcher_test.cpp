@@ -0,0 +1,96 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <QtItemTools.h>
+#include <QtItemTreeWatcher.h>
+
+#include "QtTestUtils.h"
+
+class QtItemTreeWatcherTestWithQMLEngine : public QMLEngineTest {
+};
+
+TEST_F(QtItemTreeWatcherTestWithQMLEngine, ReportsLoaderPopulation)
+{
+    auto root = GetQQuickItemWithMethod(R"(
+        property bool loaded: false
+        Loader {
+            objectName: "loader"
+            active: loaded
+            sourceComponent: Item { objectName: "page" }
+        }
+    )");
+
+    int changes = 0;
+    spix::qt::QtItemTreeWatcher watcher(root, [&] { ++changes; });
+    const auto initialSize = watcher.size();
+
+    root->setProperty("loaded", true);
+    EXPECT_GT(changes, 0);
+    EXPECT_EQ(watcher.size(), initialSize + 1);
+
+    // The loaded item is watched as well
+    changes = 0;
+    auto page = root->findChild<QQuickItem*>("loader")->childItems().first();
+    page->setObjectName("renamed");
+    EXPECT_GT(changes, 0);
+
+    changes = 0;
+    root->setProperty("loaded", false);
+    EXPECT_GT(changes, 0);
+}
+
+TEST_F(QtItemTreeWatcherTestWithQMLEngine, ReportsRepeaterPopulation)
+{
+    auto root = GetQQuickItemWithMethod(R"(
+        property int count: 0
+        Repeater {
+            objectName: "repeater"
+            model: count
+            Item { objectName: "delegate" + index }
+        }
+    )");
+
+    int changes = 0;
+    spix::qt::QtItemTreeWatcher watcher(root, [&] { ++changes; });
+    const auto initialSize = watcher.size();
+
+    root->setProperty("count", 3);
+    EXPECT_GT(changes, 0);
+    EXPECT_EQ(watcher.size(), initialSize + 3);
+
+    // The delegates are watched as well
+    changes = 0;
+    auto delegate = spix::qt::RepeaterChildAtIndex(root->findChild<QQuickItem*>("repeater"), 2);
+    ASSERT_NE(delegate, nullptr);
+    delegate->setVisible(false);
+    EXPECT_GT(changes, 0);
+
+    changes = 0;
+    root->setProperty("count", 1);
+    EXPECT_GT(changes, 0);
+}
+
+TEST_F(QtItemTreeWatcherTestWithQMLEngine, IgnoresItemsMovedOutOfTheTree)
+{
+    auto root = GetQQuickItemWithMethod(R"(
+        Item { objectName: "child" }
+    )");
+
+    int changes = 0;
+    spix::qt::QtItemTreeWatcher watcher(root, [&] { ++changes; });
+    const auto initialSize = watcher.size();
+
+    auto child = root->findChild<QQuickItem*>("child");
+    child->setParentItem(nullptr);
+    EXPECT_GT(changes, 0);
+    EXPECT_EQ(watcher.size(), initialSize - 1);
+
+    changes = 0;
+    child->setObjectName("renamed");
+    EXPECT_EQ(changes, 0);
+}
@@ -143,6 +143,16 @@ TEST_F(QtItemTestWithQMLEngine, InvokeHandlesConversion)
     EXPECT_EQ(*spy, MakeQSpyCall("true"));
 }
 
+TEST_F(QtItemTestWithQMLEngine, PropertyOfUnknownTypeIsNull)
+{
+    auto obj = this->GetQQuickItemWithMethod("property rect area: Qt.rect(1, 2, 3, 4)\nproperty string text: \"hi\"");
+    spix::QtItem item(obj);
+    EXPECT_EQ(item.property("area"), Variant(nullptr));
+    EXPECT_EQ(item.property("childrenRect"), Variant(nullptr));
+    EXPECT_EQ(item.property("text"), Variant(std::string("hi")));
+    EXPECT_EQ(item.property("missing"), Variant(nullptr));
+}
+
 // QML Return type can only be specified on Qt >= 6
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 
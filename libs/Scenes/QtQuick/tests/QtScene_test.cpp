@@ -0,0 +1,101 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include <gtest/gtest.h>
+
+#include <QtScene.h>
+
+#include "QtTestUtils.h"
+
+class QtSceneTest : public QQuickWindowTest {
+protected:
+    QtSceneTest()
+    {
+        scene.setChangeHandler([this] { ++notifiedChanges; });
+    }
+
+    spix::QtScene scene;
+    int notifiedChanges = 0;
+};
+
+TEST_F(QtSceneTest, PropertyChangesAreNotified)
+{
+    auto label = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"first\" }");
+
+    auto changes = scene.propertyChanges("window/label", "text");
+    ASSERT_GE(changes, 0);
+    EXPECT_EQ(scene.propertyChanges("window/label", "text"), changes);
+
+    label->setProperty("text", "second");
+    EXPECT_GT(notifiedChanges, 0);
+    EXPECT_GT(scene.propertyChanges("window/label", "text"), changes);
+
+    // properties without change notification have to be polled
+    EXPECT_EQ(scene.propertyChanges("window/label", "missing"), -1);
+}
+
+TEST_F(QtSceneTest, PropertyChangesOfRecreatedItem)
+{
+    auto label = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"first\" }");
+    auto changes = scene.propertyChanges("window/label", "text");
+    ASSERT_GE(changes, 0);
+
+    // Without an item there is nothing to watch
+    delete label;
+    EXPECT_GT(notifiedChanges, 0);
+    EXPECT_EQ(scene.propertyChanges("window/label", "text"), -1);
+
+    // An item created at the same path, e.g. by a Loader, is watched again
+    notifiedChanges = 0;
+    label = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"second\" }");
+    EXPECT_GT(notifiedChanges, 0);
+    auto recreatedChanges = scene.propertyChanges("window/label", "text");
+    EXPECT_GT(recreatedChanges, changes);
+
+    notifiedChanges = 0;
+    label->setProperty("text", "third");
+    EXPECT_GT(notifiedChanges, 0);
+    EXPECT_GT(scene.propertyChanges("window/label", "text"), recreatedChanges);
+}
+
+TEST_F(QtSceneTest, PropertyChangesWhenThePathResolvesToAnotherItem)
+{
+    auto label = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"first\" }");
+    auto changes = scene.propertyChanges("window/label", "text");
+    ASSERT_GE(changes, 0);
+
+    // The new item comes first in the tree, while the old one stays alive
+    notifiedChanges = 0;
+    auto other = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"other\" }");
+    other->stackBefore(label);
+    EXPECT_GT(notifiedChanges, 0);
+    EXPECT_GT(scene.propertyChanges("window/label", "text"), changes);
+}
+
+TEST_F(QtSceneTest, PropertyChangesOfSeveralPropertiesResolveThePathOnce)
+{
+    auto label = GetQQuickItemInWindow("Item { objectName: \"label\"\n property string text: \"first\" }");
+
+    auto changes = scene.propertyChanges("window/label", std::vector<std::string> {"text", "width", "missing"});
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0], scene.propertyChanges("window/label", "text"));
+    EXPECT_EQ(changes[1], scene.propertyChanges("window/label", "width"));
+    EXPECT_EQ(changes[2], -1);
+
+    // one cache lookup for all properties
+    auto lookups = [this] {
+        auto statistics = scene.statistics();
+        return std::get<long long>(statistics["itemCache.hits"]) + std::get<long long>(statistics["itemCache.misses"]);
+    };
+    auto lookupsBefore = lookups();
+    scene.propertyChanges("window/label", std::vector<std::string> {"text", "width", "missing"});
+    EXPECT_EQ(lookups(), lookupsBefore + 1);
+
+    label->setProperty("text", "second");
+    auto newChanges = scene.propertyChanges("window/label", std::vector<std::string> {"text", "width"});
+    EXPECT_GT(newChanges[0], changes[0]);
+    EXPECT_EQ(newChanges[1], changes[1]);
+}
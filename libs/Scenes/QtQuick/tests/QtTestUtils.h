@@ -11,10 +11,12 @@
 #include <gtest/gtest.h>
 
 #include <QCoreApplication>
+#include <QGuiApplication>
 #include <QObject>
 #include <QQmlComponent>
 #include <QQmlEngine>
 #include <QQuickItem>
+#include <QQuickWindow>
 #include <QtTest/QSignalSpy>
 
 class QMLEngineTest : public ::testing::Test {
@@ -66,3 +68,42 @@ protected:
     QQmlEngine engine;
     QQmlComponent component;
 };
+
+/**
+ * Fixture for tests that resolve item paths, which needs a window named
+ * "window". Uses the offscreen platform, so no display is needed.
+ */
+class QQuickWindowTest : public ::testing::Test {
+protected:
+    QQuickWindowTest()
+    : fakeArgs {"hello", "-platform", "offscreen"}
+    , fakeArgPtrs {fakeArgs[0], fakeArgs[1], fakeArgs[2]}
+    , fakeArgCount(3)
+    , app(fakeArgCount, fakeArgPtrs)
+    , engine()
+    , component(&engine)
+    {
+        window.setObjectName("window");
+    }
+
+    QQuickItem* GetQQuickItemInWindow(const char* itemDefinition)
+    {
+        std::string body = std::string("import QtQuick 2\n") + itemDefinition + "\n";
+        component.setData(QByteArray::fromStdString(body), QUrl());
+        auto item = qobject_cast<QQuickItem*>(component.create());
+        if (item == nullptr)
+            throw std::runtime_error(
+                std::string("Failed to create QML component: ") + component.errorString().toStdString());
+        item->setParent(window.contentItem());
+        item->setParentItem(window.contentItem());
+        return item;
+    }
+
+    char fakeArgs[3][20];
+    char* fakeArgPtrs[3];
+    int fakeArgCount;
+    QGuiApplication app;
+    QQmlEngine engine;
+    QQmlComponent component;
+    QQuickWindow window;
+};
@@ -8,6 +8,7 @@
 
 #include <QObject>
 #include <Spix/TestServer.h>
+#include <chrono>
 #include <memory>
 
 #include <Spix/spix_qtwidgets_export.h>
@@ -21,7 +22,7 @@ class QtWidgetsScene;
  * @brief Class that maintains and runs the test environment for QWidgets
  *
  * This QObject creates the test environment and hooks up
- * to the Qt timer to get a callback on the main thread and
+ * to the Qt event loop to get a callback on the main thread and
  * process test commands.
  *
  * Usually it is enough to create one object of this type
@@ -36,10 +37,24 @@ public:
 
     void runTestServer(TestServer& server);
 
+    /**
+     * @brief Interval in which waiting commands are checked again
+     *
+     * Commands are processed as soon as they are enqueued. Commands that
+     * have to wait for a condition (e.g. `waitForItem`) are polled in this
+     * interval until they can be executed. Defaults to 10ms. `wait` fires
+     * right at its deadline.
+     */
+    void setPollingInterval(std::chrono::milliseconds interval);
+
 protected:
     void timerEvent(QTimerEvent* event) override;
 
 private:
+    void processCommands();
+
+    int m_pollingTimerId = 0;
+    std::chrono::milliseconds m_pollingInterval {10};
     std::unique_ptr<QtWidgetsScene> m_scene;
     std::unique_ptr<CommandExecuter> m_cmdExec;
 };
@@ -13,130 +13,70 @@
 
 namespace {
 
-template <typename SelectorType>
-QObject* MatchesSpecificSelector(QObject* item, const SelectorType& specific_selector)
-{
-    // Default implementation for unknown selector types
-    return nullptr;
-}
+using spix::qt::CompiledPath;
+using spix::qt::CompiledSelector;
 
-template <>
-QObject* MatchesSpecificSelector(QObject* item, const spix::path::NameSelector& specific_selector)
-{
-    const auto& itemName = specific_selector.name();
-    if (spix::qt::GetObjectName(item) == QString::fromStdString(itemName)) {
-        return item;
-    }
-    return nullptr;
-}
+const char* text_property_name = "text";
 
-template <>
-QObject* MatchesSpecificSelector(QObject* item, const spix::path::PropertySelector& specific_selector)
+bool PropertyEquals(QObject* item, const char* propertyName, const QString& expectedValue)
 {
-    if (!item) {
-        return nullptr;
-    }
-    const auto& propertyName = specific_selector.name();
-    QVariant propertyValue = item->property(propertyName.c_str());
-
-    if (!propertyValue.isValid()) {
-        return nullptr;
-    }
-
-    return propertyValue.value<QObject*>();
-}
-
-template <>
-QObject* MatchesSpecificSelector(QObject* item, const spix::path::TypeSelector& specific_selector)
-{
-    if (!item) {
-        return nullptr;
-    }
-
-    const auto& typeName = specific_selector.type();
-    if (spix::qt::TypeStringForWidget(item) == QString::fromStdString(typeName)) {
-        return item;
-    }
-    return nullptr;
+    QVariant propertyValue = item->property(propertyName);
+    return propertyValue.isValid() && propertyValue.canConvert<QString>() && propertyValue.toString() == expectedValue;
 }
 
-template <>
-QObject* MatchesSpecificSelector(QObject* item, const spix::path::ValueSelector& specific_selector)
+QObject* MatchesSelector(QObject* item, const CompiledSelector& selector)
 {
     if (!item) {
         return nullptr;
     }
 
-    // Check if the "text" property exists and matches the specified value
-    QVariant textProperty = item->property("text");
-    if (textProperty.isValid() && textProperty.canConvert<QString>()) {
-        QString textValue = textProperty.toString();
-        if (textValue == QString::fromStdString(specific_selector.value())) {
-            return item;
+    switch (selector.kind) {
+    case CompiledSelector::Kind::Name:
+        return spix::qt::GetObjectName(item) == selector.value ? item : nullptr;
+    case CompiledSelector::Kind::Property: {
+        QVariant propertyValue = item->property(selector.property.constData());
+        if (!propertyValue.isValid()) {
+            return nullptr;
         }
+        return propertyValue.value<QObject*>();
     }
-    return nullptr;
-}
-
-template <>
-QObject* MatchesSpecificSelector(QObject* item, const spix::path::PropertyValueSelector& specific_selector)
-{
-    if (!item) {
-        return nullptr;
+    case CompiledSelector::Kind::Type:
+        return spix::qt::TypeStringForWidget(item) == selector.value ? item : nullptr;
+    case CompiledSelector::Kind::Value:
+        // Check if the "text" property exists and matches the specified value
+        return PropertyEquals(item, text_property_name, selector.value) ? item : nullptr;
+    case CompiledSelector::Kind::PropertyValue:
+        return PropertyEquals(item, selector.property.constData(), selector.value) ? item : nullptr;
     }
 
-    // Get the property name and expected value
-    const auto& propertyName = specific_selector.propertyName();
-    const auto& expectedValue = specific_selector.propertyValue();
-
-    // Check if the property exists
-    QVariant propertyValue = item->property(propertyName.c_str());
-    if (propertyValue.isValid() && propertyValue.canConvert<QString>()) {
-        QString actualValue = propertyValue.toString();
-        if (actualValue == QString::fromStdString(expectedValue)) {
-            return item;
-        }
-    }
     return nullptr;
 }
 
-QObject* MatchesSelector(QObject* item, const spix::path::Selector& selector)
-{
-    return std::visit(
-        [item](const auto& specific_selector) -> QObject* { return MatchesSpecificSelector(item, specific_selector); },
-        selector);
-}
-
 /**
  * Performs a DFS to find the first matching widget in the UI tree.
  *
- * @param pathComponents Vector of path components to match
+ * @param path Compiled path to match
  * @param currentNode Starting node for the search
  * @param matchedCount Number of path components already matched in the ancestor chain
  * @return The first matching QWidget or nullptr if none found
  */
-QWidget* FindMatchingWidget(
-    const std::vector<spix::path::Component>& pathComponents, QObject* currentNode, size_t matchedCount)
+QWidget* FindMatchingWidget(const CompiledPath& path, QObject* currentNode, size_t matchedCount)
 {
     if (!currentNode) {
         return nullptr;
     }
-    if (matchedCount >= pathComponents.size()) {
+    if (matchedCount >= path.size()) {
         return nullptr;
     }
 
-    // If we have a potential match, check if this node matches the next component
-    const auto& component = pathComponents[matchedCount];
-    const auto& selector = component.selector();
-
     // Check if this node matches the current selector
-    QObject* matchedObject = MatchesSelector(currentNode, selector);
+    QObject* matchedObject = MatchesSelector(currentNode, path[matchedCount]);
     if (matchedObject) {
         // Increment matched count as we found a match
         matchedCount++;
 
         // If we've matched all components, return this item if it's a QWidget
-        if (matchedCount == pathComponents.size()) {
+        if (matchedCount == path.size()) {
             return qobject_cast<QWidget*>(matchedObject);
         }
 
@@ -144,10 +84,8 @@ QWidget* FindMatchingWidget(
         // - if it is different from the current node or
         // - if the next component is a property selector, as a property selector might reference a property of the
         //   current node
-        const auto& nextComponent = pathComponents[matchedCount];
-        if (matchedObject != currentNode
-            || std::holds_alternative<spix::path::PropertySelector>(nextComponent.selector())) {
-            return FindMatchingWidget(pathComponents, matchedObject, matchedCount);
+        if (matchedObject != currentNode || path[matchedCount].kind == CompiledSelector::Kind::Property) {
+            return FindMatchingWidget(path, matchedObject, matchedCount);
         }
     }
 
@@ -156,7 +94,7 @@ QWidget* FindMatchingWidget(
 
     // Use ForEachChild to iterate through all children
     spix::qt::ForEachChild(currentNode, [&](QObject* child) -> bool {
-        if ((result = FindMatchingWidget(pathComponents, child, matchedCount))) {
+        if ((result = FindMatchingWidget(path, child, matchedCount))) {
             return false; // Stop iteration if we found a match
         }
         return true; // Continue iteration
@@ -234,11 +172,21 @@ QWidget* GetQWidgetAtPath(const spix::ItemPath& path)
 
     // Start DFS from the top-level widget to find the target widget
     // Skip the window component (index 0) and start matching from the first child component
-    auto components = path.components();
-    auto result = FindMatchingWidget(components, topLevelWidget, 1);
+    auto result = FindMatchingWidget(CompilePath(path), topLevelWidget, 1);
 
     return result;
 }
 
+CompiledSelector CompileSelector(const spix::path::Selector& selector)
+{
+    return spix::path::CompileSelector<QString, QByteArray>(
+        selector, &QString::fromStdString, &QByteArray::fromStdString);
+}
+
+CompiledPath CompilePath(const spix::ItemPath& path)
+{
+    return spix::path::CompilePath<QString, QByteArray>(path, &QString::fromStdString, &QByteArray::fromStdString);
+}
+
 } // namespace qt
 } // namespace spix
@@ -6,13 +6,27 @@
 
 #pragma once
 
+#include <Spix/Data/CompiledPath.h>
 #include <Spix/Data/ItemPath.h>
+#include <Spix/Data/ItemPathComponent.h>
+
+#include <QByteArray>
+#include <QString>
 
 class QWidget;
 
 namespace spix {
 namespace qt {
 
+/**
+ * A path selector with its values converted to Qt types
+ */
+using CompiledSelector = spix::path::BasicCompiledSelector<QString, QByteArray>;
+using CompiledPath = spix::path::BasicCompiledPath<QString, QByteArray>;
+
+CompiledSelector CompileSelector(const spix::path::Selector& selector);
+CompiledPath CompilePath(const spix::ItemPath& path);
+
 /**
  * Find a QWidget at the specified item path
  * @param path The item path to search for
@@ -0,0 +1,36 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtPaintEventCounter.h"
+
+#include <QEvent>
+#include <QWidget>
+
+namespace spix {
+namespace qt {
+
+long long QtPaintEventCounter::paintEvents(QWidget* window) const
+{
+    auto found = m_paintEvents.find(window);
+    return found == m_paintEvents.end() ? 0 : found->second;
+}
+
+void QtPaintEventCounter::setCounting(bool counting)
+{
+    m_counting = counting;
+}
+
+bool QtPaintEventCounter::eventFilter(QObject* watched, QEvent* event)
+{
+    // only count, never filter
+    if (m_counting && event->type() == QEvent::Paint && watched->isWidgetType()) {
+        ++m_paintEvents[static_cast<QWidget*>(watched)->window()];
+    }
+    return false;
+}
+
+} // namespace qt
+} // namespace spix
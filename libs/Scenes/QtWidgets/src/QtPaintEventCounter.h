@@ -0,0 +1,42 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <QObject>
+
+#include <unordered_map>
+
+class QWidget;
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Counts the paint events of the widgets in each window
+ *
+ * Widgets have no signal for new frames. Installed as an application
+ * wide event filter, this tells whether anything in a window was
+ * repainted since the last look.
+ */
+class QtPaintEventCounter : public QObject {
+public:
+    long long paintEvents(QWidget* window) const;
+
+    /**
+     * @brief Ignore the paint events of our own screenshots
+     */
+    void setCounting(bool counting);
+
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    std::unordered_map<QWidget*, long long> m_paintEvents;
+    bool m_counting = true;
+};
+
+} // namespace qt
+} // namespace spix
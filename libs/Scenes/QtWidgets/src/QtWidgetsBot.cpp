@@ -18,7 +18,9 @@ QtWidgetsBot::QtWidgetsBot(QObject* parent)
 , m_scene(std::make_unique<QtWidgetsScene>())
 , m_cmdExec(std::make_unique<CommandExecuter>())
 {
-    startTimer(10);
+    // Process commands as soon as they arrive instead of waiting for the next timer tick
+    m_cmdExec->setWakeupHandler(
+        [this] { QMetaObject::invokeMethod(this, [this] { processCommands(); }, Qt::QueuedConnection); });
 }
 
 QtWidgetsBot::~QtWidgetsBot() = default;
@@ -30,9 +32,33 @@ void QtWidgetsBot::runTestServer(TestServer& server)
     server.start();
 }
 
+void QtWidgetsBot::setPollingInterval(std::chrono::milliseconds interval)
+{
+    m_pollingInterval = interval;
+    if (m_pollingTimerId != 0) {
+        killTimer(m_pollingTimerId);
+        m_pollingTimerId = startTimer(m_cmdExec->nextCheckDelay(m_pollingInterval), Qt::PreciseTimer);
+    }
+}
+
 void QtWidgetsBot::timerEvent(QTimerEvent*)
+{
+    processCommands();
+}
+
+void QtWidgetsBot::processCommands()
 {
     m_cmdExec->processCommands(*m_scene);
+
+    // Only keep a timer running while commands are waiting for something. It fires
+    // right at the deadline if the waiting commands do not have to be polled.
+    if (m_pollingTimerId != 0) {
+        killTimer(m_pollingTimerId);
+        m_pollingTimerId = 0;
+    }
+    if (m_cmdExec->hasPendingCommands()) {
+        m_pollingTimerId = startTimer(m_cmdExec->nextCheckDelay(m_pollingInterval), Qt::PreciseTimer);
+    }
 }
 
 } // namespace spix
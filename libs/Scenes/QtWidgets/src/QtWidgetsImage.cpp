@@ -0,0 +1,129 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtWidgetsImage.h"
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QImageWriter>
+#include <QPainter>
+#include <QString>
+
+#include <cstring>
+
+namespace spix {
+
+QtWidgetsImage::QtWidgetsImage(QImage image)
+: m_image(std::move(image))
+{
+}
+
+int QtWidgetsImage::width() const
+{
+    return m_image.width();
+}
+
+int QtWidgetsImage::height() const
+{
+    return m_image.height();
+}
+
+std::string QtWidgetsImage::rgbaPixels() const
+{
+    auto rgbaImage = m_image.convertToFormat(QImage::Format_RGBA8888);
+    const auto rowLength = static_cast<size_t>(rgbaImage.width()) * 4;
+
+    std::string pixels;
+    pixels.reserve(rowLength * rgbaImage.height());
+    for (int y = 0; y < rgbaImage.height(); ++y) {
+        pixels.append(reinterpret_cast<const char*>(rgbaImage.constScanLine(y)), rowLength);
+    }
+
+    return pixels;
+}
+
+void QtWidgetsImage::writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const
+{
+    if (m_image.format() == QImage::Format_RGBA8888) {
+        const auto rowLength = static_cast<size_t>(width) * 4;
+        for (int row = 0; row < height; ++row) {
+            std::memcpy(pixels + row * stride, m_image.constScanLine(y + row) + x * 4, rowLength);
+        }
+        return;
+    }
+
+    // the painter converts the pixels while it draws them into the buffer
+    QImage target(reinterpret_cast<uchar*>(pixels), width, height, static_cast<int>(stride), QImage::Format_RGBA8888);
+    QPainter painter(&target);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.drawImage(0, 0, m_image, x, y, width, height);
+}
+
+bool QtWidgetsImage::encode(const ImageEncoding& encoding, std::string& data) const
+{
+    const char* format = nullptr;
+    int quality = encoding.level();
+
+    switch (encoding.format()) {
+    case ImageEncoding::Format::Png:
+        format = "png";
+        // Qt maps the quality 0..100 to the zlib compression level 9..0
+        if (quality != ImageEncoding::DefaultLevel) {
+            quality = 100 - quality * 11;
+        }
+        break;
+    case ImageEncoding::Format::Jpeg:
+        format = "jpeg";
+        break;
+    case ImageEncoding::Format::WebP:
+        format = "webp";
+        break;
+    default:
+        return false;
+    }
+
+    QByteArray byteArray;
+    QBuffer buffer(&byteArray);
+    buffer.open(QIODevice::WriteOnly);
+
+    QImageWriter writer(&buffer, format);
+    writer.setQuality(quality);
+    if (!writer.write(m_image)) {
+        return false;
+    }
+
+    data.assign(byteArray.constData(), static_cast<size_t>(byteArray.size()));
+    return true;
+}
+
+bool QtWidgetsImage::save(const std::string& filePath) const
+{
+    return m_image.save(QString::fromStdString(filePath));
+}
+
+std::unique_ptr<Image> QtWidgetsImage::copy(int x, int y, int width, int height) const
+{
+    return std::make_unique<QtWidgetsImage>(m_image.copy(x, y, width, height));
+}
+
+std::unique_ptr<Image> QtWidgetsImage::scaled(int width, int height) const
+{
+    // smoothing a large image is slow, so shrink it without filtering
+    // to twice the target size first and only smooth the last step
+    auto image = m_image;
+    if (image.width() > width * 2 && image.height() > height * 2) {
+        image = image.scaled(width * 2, height * 2, Qt::IgnoreAspectRatio, Qt::FastTransformation);
+    }
+    return std::make_unique<QtWidgetsImage>(
+        image.scaled(width, height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+}
+
+const QImage& QtWidgetsImage::qimage() const
+{
+    return m_image;
+}
+
+} // namespace spix
@@ -0,0 +1,34 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Scene/Image.h>
+
+#include <QImage>
+
+namespace spix {
+
+class QtWidgetsImage : public Image {
+public:
+    QtWidgetsImage(QImage image);
+
+    int width() const override;
+    int height() const override;
+    std::string rgbaPixels() const override;
+    void writeRgbaPixels(int x, int y, int width, int height, char* pixels, size_t stride) const override;
+    bool encode(const ImageEncoding& encoding, std::string& data) const override;
+    bool save(const std::string& filePath) const override;
+    std::unique_ptr<Image> copy(int x, int y, int width, int height) const override;
+    std::unique_ptr<Image> scaled(int width, int height) const override;
+
+    const QImage& qimage() const;
+
+private:
+    QImage m_image;
+};
+
+} // namespace spix
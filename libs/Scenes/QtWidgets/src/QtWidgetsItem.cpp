@@ -10,6 +10,8 @@
 #include <QMetaObject>
 #include <QWidget>
 
+#include <stdexcept>
+
 #include <QtWidgetsItemTools.h>
 
 namespace spix {
@@ -49,6 +51,16 @@ std::string QtWidgetsItem::stringProperty(const std::string& name) const
     return value.toString().toStdString();
 }
 
+Variant QtWidgetsItem::property(const std::string& name) const
+{
+    try {
+        return qt::QVariantToVariant(qobject()->property(name.c_str()));
+    } catch (const std::runtime_error&) {
+        // e.g. QRectF or QObject* values
+        return Variant(nullptr);
+    }
+}
+
 void QtWidgetsItem::setStringProperty(const std::string& name, const std::string& value)
 {
     qobject()->setProperty(name.c_str(), value.c_str());
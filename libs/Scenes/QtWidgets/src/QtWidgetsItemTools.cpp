@@ -7,6 +7,7 @@
 #include "QtWidgetsItemTools.h"
 
 #include <QDateTime>
+#include <QHash>
 #include <QMetaMethod>
 #include <QRegularExpression>
 #include <QWidget>
@@ -30,12 +31,21 @@ QString TypeStringForWidget(QObject* object)
         return "";
     }
 
-    auto typeName = QString(object->metaObject()->className());
+    // Type names are needed for every object visited in a search, so they are only built once per class
+    static QHash<const QMetaObject*, QString> typeNames;
+    const QMetaObject* metaObject = object->metaObject();
+    auto typeName = typeNames.constFind(metaObject);
+    if (typeName != typeNames.constEnd()) {
+        return *typeName;
+    }
+
     // Remove Q prefix from widget class names (e.g., QPushButton -> PushButton)
-    if (typeName.startsWith("Q")) {
-        typeName = typeName.mid(1);
+    auto newTypeName = QString(metaObject->className());
+    if (newTypeName.startsWith("Q")) {
+        newTypeName = newTypeName.mid(1);
     }
-    return typeName;
+    typeNames.insert(metaObject, newTypeName);
+    return newTypeName;
 }
 
 void ForEachChild(QObject* object, const std::function<bool(QObject*)>& callback)
@@ -45,10 +55,10 @@ void ForEachChild(QObject* object, const std::function<bool(QObject*)>& callback
     }
 
     // For widgets, iterate through child widgets
-    if (auto widget = qobject_cast<QWidget*>(object)) {
-        const QList<QWidget*> children = widget->findChildren<QWidget*>(QString(), Qt::FindDirectChildrenOnly);
-        for (QWidget* child : children) {
-            if (!callback(child)) {
+    if (qobject_cast<QWidget*>(object)) {
+        // Same as findChildren<QWidget*>() for direct children, without building a new list
+        for (auto* child : object->children()) {
+            if (child->isWidgetType() && !callback(child)) {
                 return;
             }
         }
@@ -7,6 +7,7 @@
 #include "QtWidgetsScene.h"
 #include "FindQtWidget.h"
 
+#include <QtWidgetsImage.h>
 #include <QtWidgetsItem.h>
 #include <QtWidgetsItemTools.h>
 #include <Spix/Data/ItemPath.h>
@@ -14,6 +15,7 @@
 #include <QApplication>
 #include <QBuffer>
 #include <QByteArray>
+#include <QImage>
 #include <QObject>
 #include <QPixmap>
 #include <QWidget>
@@ -67,4 +69,106 @@ std::string QtWidgetsScene::takeScreenshotAsBase64(const ItemPath& targetItem)
     return byteArray.toBase64().toStdString();
 }
 
+std::unique_ptr<Image> QtWidgetsScene::grabImage(const ItemPath& targetItem)
+{
+    auto widget = qt::GetQWidgetAtPath(targetItem);
+    if (!widget) {
+        return {};
+    }
+
+    return std::make_unique<QtWidgetsImage>(grabWidget(widget, CaptureMode::Default));
+}
+
+void QtWidgetsScene::grabImageAsync(const ItemPath& targetItem, CaptureMode mode, ImageHandler handler)
+{
+    auto widget = qt::GetQWidgetAtPath(targetItem);
+    if (!widget) {
+        handler(nullptr);
+        return;
+    }
+
+    // widgets are painted synchronously, so the image is ready right away
+    handler(std::make_unique<QtWidgetsImage>(grabWidget(widget, mode)));
+}
+
+std::unique_ptr<Image> QtWidgetsScene::loadImage(const std::string& filePath)
+{
+    QImage image(QString::fromStdString(filePath));
+    if (image.isNull()) {
+        return {};
+    }
+
+    return std::make_unique<QtWidgetsImage>(std::move(image));
+}
+
+bool QtWidgetsScene::startRecording(const ItemPath& windowPath, int fps, const std::string& filePath)
+{
+    auto widget = qt::GetQWidgetAtPath(windowPath);
+    if (!widget || m_recording) {
+        return false;
+    }
+
+    auto recorder = std::make_unique<FrameRecorder>(filePath, fps);
+    if (!recorder->isOpen()) {
+        return false;
+    }
+
+    m_recording = std::make_unique<qt::QtWidgetsWindowRecorder>(widget->window(), std::move(recorder));
+    return true;
+}
+
+std::unique_ptr<FrameRecorder> QtWidgetsScene::stopRecording()
+{
+    if (!m_recording) {
+        return {};
+    }
+
+    auto recorder = m_recording->stop();
+    m_recording.reset();
+    return recorder;
+}
+
+long long QtWidgetsScene::renderedFrames(const ItemPath& path)
+{
+    auto widget = qt::GetQWidgetAtPath(path);
+    if (!widget) {
+        return -1;
+    }
+
+    // installed on first use, as it sees every event of the application
+    if (!m_paintEventCounter) {
+        m_paintEventCounter = std::make_unique<qt::QtPaintEventCounter>();
+        qApp->installEventFilter(m_paintEventCounter.get());
+    }
+
+    return m_paintEventCounter->paintEvents(widget->window());
+}
+
+QImage QtWidgetsScene::grabWidget(QWidget* widget, CaptureMode mode)
+{
+    // grabbing paints the widget, which is not a new frame of the application
+    if (m_paintEventCounter) {
+        m_paintEventCounter->setCounting(false);
+    }
+
+    QImage image;
+    auto window = widget->window();
+    if (mode == CaptureMode::Window && window != widget) {
+        // paint the whole window and crop the widget, to include siblings that overlap it
+        auto windowImage = window->grab().toImage();
+        auto ratio = windowImage.devicePixelRatio();
+        QRect widgetRect(widget->mapTo(window, QPoint(0, 0)), widget->size());
+        image = windowImage.copy(QRect(widgetRect.x() * ratio, widgetRect.y() * ratio, widgetRect.width() * ratio,
+            widgetRect.height() * ratio));
+    } else {
+        // QWidget::grab() paints only the widget and its children
+        image = widget->grab().toImage();
+    }
+
+    if (m_paintEventCounter) {
+        m_paintEventCounter->setCounting(true);
+    }
+    return image;
+}
+
 } // namespace spix
@@ -7,10 +7,14 @@
 #pragma once
 
 #include <QByteArray>
+#include <QImage>
+#include <QtPaintEventCounter.h>
 #include <QtWidgetsEvents.h>
+#include <QtWidgetsWindowRecorder.h>
 #include <Spix/Data/ItemPath.h>
 #include <Spix/Scene/Scene.h>
 
+#include <memory>
 #include <string>
 
 class QWidget;
@@ -30,9 +34,19 @@ public:
     // Tasks
     void takeScreenshot(const ItemPath& targetItem, const std::string& filePath) override;
     std::string takeScreenshotAsBase64(const ItemPath& targetItem) override;
+    std::unique_ptr<Image> grabImage(const ItemPath& targetItem) override;
+    void grabImageAsync(const ItemPath& targetItem, CaptureMode mode, ImageHandler handler) override;
+    std::unique_ptr<Image> loadImage(const std::string& filePath) override;
+    bool startRecording(const ItemPath& windowPath, int fps, const std::string& filePath) override;
+    std::unique_ptr<FrameRecorder> stopRecording() override;
+    long long renderedFrames(const ItemPath& path) override;
 
 private:
+    QImage grabWidget(QWidget* widget, CaptureMode mode);
+
     QtWidgetsEvents m_events;
+    std::unique_ptr<qt::QtWidgetsWindowRecorder> m_recording;
+    std::unique_ptr<qt::QtPaintEventCounter> m_paintEventCounter;
 };
 
 } // namespace spix
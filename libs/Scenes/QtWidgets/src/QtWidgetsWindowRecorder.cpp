@@ -0,0 +1,52 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#include "QtWidgetsWindowRecorder.h"
+
+#include <QtWidgetsImage.h>
+
+#include <QPixmap>
+
+#include <chrono>
+
+namespace spix {
+namespace qt {
+
+QtWidgetsWindowRecorder::QtWidgetsWindowRecorder(QWidget* window, std::unique_ptr<FrameRecorder> recorder)
+: m_window(window)
+, m_recorder(std::move(recorder))
+{
+    auto interval = std::chrono::duration_cast<std::chrono::milliseconds>(m_recorder->frameInterval());
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(static_cast<int>(interval.count()));
+    QObject::connect(&m_timer, &QTimer::timeout, [this]() { captureFrame(); });
+    m_timer.start();
+
+    captureFrame();
+}
+
+std::unique_ptr<FrameRecorder> QtWidgetsWindowRecorder::stop()
+{
+    m_timer.stop();
+    return std::move(m_recorder);
+}
+
+void QtWidgetsWindowRecorder::captureFrame()
+{
+    if (!m_window || !m_recorder) {
+        return;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto image = std::make_unique<QtWidgetsImage>(m_window->grab().toImage());
+    auto captureTime
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+
+    m_recorder->addFrame(std::move(image), captureTime);
+}
+
+} // namespace qt
+} // namespace spix
@@ -0,0 +1,41 @@
+/***
+ * Copyright (C) Falko Axmann. All rights reserved.
+ * Licensed under the MIT license.
+ * See LICENSE.txt file in the project root for full license information.
+ ****/
+
+#pragma once
+
+#include <Spix/Scene/FrameRecorder.h>
+
+#include <QPointer>
+#include <QTimer>
+#include <QWidget>
+
+#include <memory>
+
+namespace spix {
+namespace qt {
+
+/**
+ * @brief Feeds the frames of a top level widget into a `FrameRecorder`
+ *
+ * Widgets have no signal for new frames, so the window is rendered
+ * at the target frame rate.
+ */
+class QtWidgetsWindowRecorder {
+public:
+    QtWidgetsWindowRecorder(QWidget* window, std::unique_ptr<FrameRecorder> recorder);
+
+    std::unique_ptr<FrameRecorder> stop();
+
+private:
+    void captureFrame();
+
+    QPointer<QWidget> m_window;
+    QTimer m_timer;
+    std::unique_ptr<FrameRecorder> m_recorder;
+};
+
+} // namespace qt
+} // namespace spix